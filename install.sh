@@ -31,6 +31,7 @@ $ch	-l or --logging       enable logging (needed for verbosity level > 2)
 $ch	-s or --statistics    enable costly statistics (may impact runtime)
 $ch	-a or --all           enable all above flags except 'assert' and 'verbosity'
 $ch	--ncolors             disable colors in all solver outputs
+$ch	--hotsp               interleave per-variable search fields (CPU solver)
 $ch	--clean=<target>      remove old installation of <cpu | gpu | all> solvers
 $ch	--standard=<n>        compile with <11 | 14 | 17> c++ standard
 $ch	--gextra="flags"      pass extra "flags" to the GPU compiler (nvcc)
@@ -62,6 +63,7 @@ clean=""
 assert=0
 logging=0
 ncolors=0
+hotsp=0
 pedantic=0
 standard=17
 statistics=0
@@ -81,6 +83,7 @@ do
 	
     	-l|--logging) logging=1;;
 		--ncolors) ncolors=1;;
+		--hotsp) hotsp=1;;
 	-s|--statistics) statistics=1;;
 
 	-c|--cpu) icpu=1;;
@@ -292,6 +295,21 @@ if [[ "$HOST_OS" == *"cygwin"* ]]; then pedantic=0; fi
 [ $logging = 1 ] && CCFLAGS="$CCFLAGS -DLOGGING"
 [ $statistics = 1 ] && CCFLAGS="$CCFLAGS -DSTATISTICS"
 [ $ncolors = 1 ] && CCFLAGS="$CCFLAGS -DNCOLORS"
+[ $hotsp = 1 ] && CCFLAGS="$CCFLAGS -DHOTSP"
+
+# compression libraries available for reading compressed formulas
+# and writing compressed proofs (gzip and zstd only)
+LIBRARIES="-lpthread"
+codecs=""
+proofcodecs=""
+havelib () {
+	printf "#include <$1>\nint main() { return 0; }\n" | \
+	$HOST_COMPILER -x c++ - -o /dev/null $2 >/dev/null 2>&1
+}
+if havelib zlib.h -lz; then CCFLAGS="$CCFLAGS -DHAVE_ZLIB"; LIBRARIES="$LIBRARIES -lz"; codecs="$codecs gzip"; proofcodecs="$proofcodecs gzip"; fi
+if havelib lzma.h -llzma; then CCFLAGS="$CCFLAGS -DHAVE_LZMA"; LIBRARIES="$LIBRARIES -llzma"; codecs="$codecs xz"; fi
+if havelib bzlib.h -lbz2; then CCFLAGS="$CCFLAGS -DHAVE_BZIP2"; LIBRARIES="$LIBRARIES -lbz2"; codecs="$codecs bzip2"; fi
+if havelib zstd.h -lzstd; then CCFLAGS="$CCFLAGS -DHAVE_ZSTD"; LIBRARIES="$LIBRARIES -lzstd"; codecs="$codecs zstd"; proofcodecs="$proofcodecs zstd"; fi
 
 CCFLAGS="$ARCH -std=c++$standard$CCFLAGS"
 
@@ -306,13 +324,19 @@ log "building with:"
 log ""
 log "'$CCFLAGS'"
 log ""
+[ -z "$codecs" ] && codecs=" none"
+log "compressed inputs:$codecs"
+[ -z "$proofcodecs" ] && proofcodecs=" none"
+log "compressed proofs:$proofcodecs"
+log ""
 
 [ ! -f $cputemplate ] && error "cannot find the CPU makefile template"
 
 cp $cputemplate $makefile
 sed -i "s|^CCFLAGS.*|CCFLAGS := $CCFLAGS|" $makefile
-sed -i "s/^BIN.*/BIN := $binary/" $makefile
-sed -i "s/^LIB.*/LIB := $library/" $makefile
+sed -i "s|^LIBRARIES.*|LIBRARIES := $LIBRARIES|" $makefile
+sed -i "s/^BIN :=.*/BIN := $binary/" $makefile
+sed -i "s/^LIB :=.*/LIB := $library/" $makefile
 
 log ""
 
@@ -49,15 +49,20 @@ uint32 Solver::iadd()
 	PFLOG2(3, "  adding new variable %d (%d unassigned)..", v, inf.unassigned);
 	const uint32 lit = V2L(v);
 	inf.nDualVars = lit + 2;
+	bt.expand(lit + 2);
 	wt.expand(lit + 2);
 	ivalue.expand(lit + 2, UNDEFINED);
 	bumps.expand(v + 1, 0);
 	activity.expand(v + 1, 0.0);
-	ilevel.expand(v + 1, UNDEFINED);
 	iphase.expand(v + 1, opts.polarity);
-	isource.expand(v + 1, NOREF);
 	ifrozen.expand(v + 1, 0);
+#if defined(HOTSP)
+	ihot.expand(v + 1), ihot[v] = HOTVAR();
+#else
+	ilevel.expand(v + 1, UNDEFINED);
+	isource.expand(v + 1, NOREF);
 	ivstate.expand(v + 1), ivstate[v] = VSTATE();
+#endif
 	model.maxVar = v;
 	model.lits.expand(v + 1), model.lits[v] = lit;
 	vorg.expand(v + 1), vorg[v] = v;
@@ -70,9 +75,15 @@ uint32 Solver::iadd()
 			proof.init(sp);
 	}
 	sp->value = ivalue;
+#if defined(HOTSP)
+	sp->level = &ihot[0].level;
+	sp->source = &ihot[0].source;
+	sp->vstate = &ihot[0].vstate;
+#else
 	sp->level = ilevel;
 	sp->source = isource;
 	sp->vstate = ivstate;
+#endif
 	sp->psaved = iphase;
 	return v;
 }
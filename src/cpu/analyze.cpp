@@ -178,6 +178,10 @@ void Solver::analyze()
 		bumpVariables();
 	}
 	else assert(learntC.size() == 1);
+	if (opts.lrat_en) {
+		hintChain(conflict, learntC, learntC.size());
+		clearMinimized();
+	}
 	// backjump control
 	C_REF added = backjump();
 	// clear 
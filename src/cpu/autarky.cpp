@@ -46,7 +46,7 @@ uint32 Solver::autarkReasoning(LIT_ST* autarkies)
 {
 	assert(analyzed.empty());
 	const LIT_ST* values = sp->value;
-	const VSTATE* states = sp->vstate;
+	CVSTATES states = sp->vstate;
 	// assign all variables with saved phases
 	uint32 assigned = 0;
 	forall_variables(v) {
@@ -77,13 +77,12 @@ uint32 Solver::autarkReasoning(LIT_ST* autarkies)
 		if (inactive(lit)) continue;
 		LIT_ST val = autarkies[lit];
 		if (val > 0) continue;
-		WL& ws = wt[FLIP(lit)];
-		forall_watches(ws, i) {
-			const WATCH w = *i;
-			assert(w.binary());
-			const C_REF ref = w.ref;
-			assert(!cm.deleted(ref));
-			if (cm[ref].learnt()) continue;
+		BL& bs = bt[FLIP(lit)];
+		forall_bwatches(bs, i) {
+			const BWATCH w = *i;
+			assert(!cm.deleted(w.ref()));
+			assert(w.learnt() == cm[w.ref()].learnt());
+			if (w.learnt()) continue;
 			const uint32 other = w.imp;
 			assert(UNASSIGNED(values[other]));
 			const LIT_ST otherval = autarkies[other];
@@ -173,28 +172,28 @@ void Solver::autarky()
 
 void Solver::filterAutarky()
 {
-	const VSTATE* states = sp->vstate;
+	CVSTATES states = sp->vstate;
 	forall_literal(lit) {
 		const bool litelim = MELTED(states[ABS(lit)].state);
-		WL& ws = wt[FLIP(lit)];
-		WATCH* j = ws;
-		forall_watches(ws, i) {
-			const WATCH w = *i;
-			if (w.binary()) {
-				const uint32 imp = w.imp;
-				CHECKLIT(imp);
-				const bool impelim = MELTED(states[ABS(imp)].state);
-				if (litelim || impelim) {
-					if (lit < imp) {
-						const C_REF ref = w.ref;
-						removeClause(cm[ref], ref);
-					}
+		const uint32 flit = FLIP(lit);
+		wt[flit].clear();
+		BL& bs = bt[flit];
+		BWATCH* j = bs;
+		forall_bwatches(bs, i) {
+			const BWATCH w = *i;
+			const uint32 imp = w.imp;
+			CHECKLIT(imp);
+			const bool impelim = MELTED(states[ABS(imp)].state);
+			if (litelim || impelim) {
+				if (lit < imp) {
+					const C_REF ref = w.ref();
+					removeClause(cm[ref], ref);
 				}
-				else
-					*j++ = w;
 			}
+			else
+				*j++ = w;
 		}
-		ws.resize(int(j - ws));
+		bs.resize(int(j - bs));
 	}
 }
 
@@ -208,32 +207,30 @@ uint32 Solver::propAutarky(const LIT_ST* values, LIT_ST* autarkies)
 		CHECKLIT(lit);
 		assert(UNASSIGNED(autarkies[lit]));
 		PFLOG2(4, "  propagating autarkic literal %d", l2i(lit));
+		BL& bs = bt[FLIP(lit)];
+		forall_bwatches(bs, i) {
+			const BWATCH w = *i;
+			assert(w.learnt() == cm[w.ref()].learnt());
+			if (w.learnt()) continue;
+			const uint32 imp = w.imp;
+			CHECKLIT(imp);
+			assert(imp != lit);
+			LIT_ST impval = values[imp];
+			if (impval > 0) continue;
+			assert(UNASSIGNED(impval));
+			if (!autarkies[imp]) {
+				cancelAutark(true, imp, autarkies);
+				unassigned++;
+			}
+		}
 		WL& ws = wt[FLIP(lit)];
-		WATCH* j = ws;
 		forall_watches(ws, i) {
 			const WATCH w = *i;
-			const C_REF ref = w.ref;
-			CLAUSE& c = cm[ref];
-			if (w.binary()) {
-				*j++ = w;
-				if (c.learnt()) continue;
-				const uint32 imp = w.imp;
-				CHECKLIT(imp);
-				assert(imp != lit);
-				LIT_ST impval = values[imp];
-				if (impval > 0) continue;
-				assert(UNASSIGNED(impval));
-				if (!autarkies[imp]) {
-					cancelAutark(true, imp, autarkies);
-					unassigned++;
-				}
-			}
-			else {
-				assert(ABS(w.imp) == ABS(lit));
-				unassigned += propAutarkClause(true, ref, c, values, autarkies);
-			}
+			assert(ABS(w.imp) == ABS(lit));
+			const C_REF ref = w.ref();
+			unassigned += propAutarkClause(true, ref, cm[ref], values, autarkies);
 		}
-		ws.resize(int(j - ws));
+		ws.clear();
 	}
 	return unassigned;
 }
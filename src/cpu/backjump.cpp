@@ -64,8 +64,8 @@ C_REF Solver::backjump()
 		stats.units.learnt++;
 	}
 	else {
-		if (opts.proof_en) proof.addClause(learntC);
 		C_REF r = newClause(learntC, true);
+		if (opts.proof_en) proof.addClause(cm[r]);
 		enqueue(*learntC, jmplevel, r);
 		return r;
 	}
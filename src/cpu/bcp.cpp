@@ -17,93 +17,138 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 **********************************************************************************/
 
 #include "solver.h"
+#include "simd.h"
 using namespace ParaFROST;
 
+inline uint32* Solver::searchWatch(CLAUSE& c, const LIT_ST* values, uint32& newlit)
+{
+	uint32* cmid = c.mid(), * cend = c.end();
+	uint32* k = cmid;
+#if defined(SIMD_AVX2)
+	if (simdsearch && c.size() >= opts.simdsearch_min) {
+		k = avx2NonFalse(values, cmid, cend);
+		if (k == cend) {
+			assert(c.pos() <= c.size());
+			k = avx2NonFalse(values, c + 2, cmid);
+			// 'newlit' must be falsified if nothing was found as in the scalar search
+			if (k == cmid) newlit = (cmid == c + 2) ? *(cend - 1) : *(cmid - 1);
+			else newlit = *k;
+		}
+		else newlit = *k;
+		assert(k >= c + 2 && k <= c.end());
+		return k;
+	}
+#endif
+	LIT_ST _false_ = UNDEFINED;
+	while (k != cend && (_false_ = !values[newlit = *k])) k++;
+	assert(_false_ != UNDEFINED);
+	if (_false_) {
+		k = c + 2;
+		assert(c.pos() <= c.size());
+		while (k != cmid && (_false_ = !values[newlit = *k])) k++;
+	}
+	assert(k >= c + 2 && k <= c.end());
+	return k;
+}
+
 bool Solver::BCP()
 {
 	conflict = NOREF;
 	const uint32 propsbefore = sp->propagated;
 	LIT_ST* values = sp->value;
+	const uint32 lookahead = opts.prefetch_lookahead;
+	uint32 propagatedbin = sp->propagated;
 	bool isConflict = false;
 	while (!isConflict && sp->propagated < trail.size()) {
+		//=============== binary ================//
+		if (propagatedbin < trail.size()) {
+			isConflict = propbinary(trail[propagatedbin++], stats.searchticks);
+			continue;
+		}
+		//================ large =================//
 		const uint32 assign = trail[sp->propagated++], f_assign = FLIP(assign);
 		const int level = l2dl(assign);
 		CHECKLIT(assign);
-		PFLOG2(4, "  propagating %d@%d", l2i(assign), level);
+		PFLOG2(4, "  propagating %d@%d in large clauses", l2i(assign), level);
 		WL& ws = wt[assign];
 		uint64 ticks = cacheLines(ws.size(), sizeof(WATCH));
 		WATCH* i = ws, *j = i, * wend = ws.end();
+		WATCH* p = i; // prefetching pointer
+		uint64 inflight = 0; // bit 'k' is set if the clause of watch 'i + k' was prefetched
+		uint32 ahead = 0, prefetched = 0;
 		while (i != wend) {
+			// keep clauses of the next 'lookahead' non-blocked watches in flight,
+			// at most 64 watches ahead so each one has its bit in 'inflight'
+			while (ahead < lookahead && p != wend && p - i < 64) {
+				const WATCH pw = *p;
+				if (values[pw.imp] <= 0) {
+#if defined(_WIN32)
+					PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, cm.clause(pw.ref()));
+#else
+					__builtin_prefetch(cm.clause(pw.ref()), 0, 1);
+#endif
+					inflight |= 1ULL << (p - i);
+					ahead++, prefetched++;
+				}
+				p++;
+			}
+			// the window slides whether or not the watch is blocked now
+			ahead -= uint32(inflight & 1);
+			inflight >>= 1;
 			const WATCH w = *j++ = *i++;
+			assert(!w.binary());
 			const uint32 imp = w.imp;
 			CHECKLIT(imp);
 			assert(imp != f_assign);
 			const LIT_ST impVal = values[imp];
 			if (impVal > 0) continue; // blocking literal
-			const C_REF ref = w.ref;
-			//=============== binary ================//
-			if (w.binary()) {
-				if (cm.deleted(ref)) { j--; continue; } // use cm 'stencil' to avoid dereferencing the clause
-				if (impVal) enqueue(imp, level, ref);
-				else { conflict = ref; break; }
-			}
-			//================ large =================//
+			ticks++;
+			const C_REF ref = w.ref();
+			if (cm.deleted(ref)) { j--; continue; } // use cm 'stencil' to avoid dereferencing the clause
+			CLAUSE& c = cm[ref];
+			assert(c.size() > 2);
+			assert(c[0] != c[1]);
+			const uint32 other = c[0] ^ c[1] ^ f_assign; // Thanks to CaDiCaL solver
+			CHECKLIT(other);
+			// check if first literal is true
+			const LIT_ST otherVal = values[other];
+			if (otherVal > 0) 
+				(j - 1)->imp = other; // satisfied, replace "w.imp" with new blocking "other"
 			else {
-				ticks++;
-				if (cm.deleted(ref)) { j--; continue; } // use cm 'stencil' to avoid dereferencing the clause
-				CLAUSE& c = cm[ref];
-				assert(c.size() > 2);
-				assert(c[0] != c[1]);
-				const uint32 other = c[0] ^ c[1] ^ f_assign; // Thanks to CaDiCaL solver
-				CHECKLIT(other);
-				// check if first literal is true
-				const LIT_ST otherVal = values[other];
-				if (otherVal > 0) 
-					(j - 1)->imp = other; // satisfied, replace "w.imp" with new blocking "other"
-				else {
-					// === search for (un)-assigned-1 literal to watch
-					uint32* cmid = c.mid(), * cend = c.end();
-					uint32* k = cmid, newlit = 0;
-					LIT_ST _false_ = UNDEFINED;
-					while (k != cend && (_false_ = !values[newlit = *k])) k++;
-					assert(_false_ != UNDEFINED);
-					if (_false_) {
-						k = c + 2;
-						assert(c.pos() <= c.size());
-						while (k != cmid && (_false_ = !values[newlit = *k])) k++;
-					}
-					assert(k >= c + 2 && k <= c.end());
-					c.set_pos(int(k - c)); // set new position
-					// ======== end of search ========
-					LIT_ST val = values[newlit];
-					if (val > 0) // found satisfied new literal (update "imp")
-						(j - 1)->imp = newlit; 
-					else if (UNASSIGNED(val)) { // found new unassigned literal to watch
-						c[0] = other;
-						c[1] = newlit;
-						*k = f_assign;
-						assert(c[0] != c[1]);
-						attachWatch(newlit, other, ref, c.size());
-						j--; // remove j-watch from current assignment
-						ticks++;
-					}
-					else if (UNASSIGNED(otherVal)) { // clause is unit
-						assert(!val);
-						enqueueImp(other, ref);
-					}
-					else { // clause is conflicting
-						assert(!val);
-						assert(!otherVal);
-						PFLCONFLICT(this, 3, other);
-						conflict = ref;
-						break;
-					}
+				// === search for (un)-assigned-1 literal to watch
+				uint32 newlit = 0;
+				uint32* k = searchWatch(c, values, newlit);
+				c.set_pos(int(k - c)); // set new position
+				// ======== end of search ========
+				LIT_ST val = values[newlit];
+				if (val > 0) // found satisfied new literal (update "imp")
+					(j - 1)->imp = newlit; 
+				else if (UNASSIGNED(val)) { // found new unassigned literal to watch
+					c[0] = other;
+					c[1] = newlit;
+					*k = f_assign;
+					assert(c[0] != c[1]);
+					attachWatch(newlit, other, ref, c.size());
+					j--; // remove j-watch from current assignment
+					ticks++;
+				}
+				else if (UNASSIGNED(otherVal)) { // clause is unit
+					assert(!val);
+					enqueueImp(other, ref);
+				}
+				else { // clause is conflicting
+					assert(!val);
+					assert(!otherVal);
+					PFLCONFLICT(this, 3, other);
+					conflict = ref;
+					break;
 				}
 			}
 		} // end of watches loop 
 		while (i != wend) *j++ = *i++;
 		ws.resize(int(j - ws));
 		stats.searchticks += ticks;
+		stats.prefetched += prefetched;
 		isConflict = NEQUAL(conflict, NOREF);
 	} // end of trail loop
 	stats.searchprops += sp->propagated - propsbefore;
@@ -120,7 +165,7 @@ bool Solver::BCPProbe() {
 	uint32 propagatedbin = sp->propagated;
 	while (!isConflict && sp->propagated < trail.size()) {
 		if (propagatedbin < trail.size())
-			isConflict = propbinary(trail[propagatedbin++]);
+			isConflict = propbinary(trail[propagatedbin++], stats.probeticks);
 		else
 			isConflict = proplarge(trail[sp->propagated++], true);
 	}
@@ -131,33 +176,34 @@ bool Solver::BCPVivify() {
 	assert(UNSOLVED(cnfstate));
 	conflict = NOREF;
 	bool isConflict = false;
+	uint32 propagatedbin = sp->propagated;
 	while (!isConflict && sp->propagated < trail.size()) {
-		isConflict = proplarge(trail[sp->propagated++], false);
+		if (propagatedbin < trail.size())
+			isConflict = propbinary(trail[propagatedbin++], stats.probeticks);
+		else
+			isConflict = proplarge(trail[sp->propagated++], false);
 	}
 	return isConflict;
 }
 
-inline bool Solver::propbinary(const uint32& assign)
+inline bool Solver::propbinary(const uint32& assign, uint64& ticks)
 {
 	CHECKLIT(assign);
-	assert(DL() == 1);
 	const int level = l2dl(assign);
 	PFLOG2(4, "  propagating %d@%d in binaries", l2i(assign), level);
 	LIT_ST* values = sp->value;
-	WL& ws = wt[assign];
-	forall_watches(ws, i) {
-		const WATCH w = *i;
-		if (w.binary()) {
-			const uint32 imp = w.imp;
-			CHECKLIT(imp);
-			assert(imp != FLIP(assign));
-			const LIT_ST impVal = values[imp];
-			if (impVal > 0) continue; 
-			const C_REF ref = w.ref;
-			if (cm.deleted(ref)) continue;
-			if (impVal) enqueue(imp, level, ref);
-			else { conflict = ref; return true; }
-		}
+	BL& bs = bt[assign];
+	ticks += cacheLines(bs.size(), sizeof(BWATCH));
+	forall_bwatches(bs, i) {
+		const uint32 imp = i->imp;
+		CHECKLIT(imp);
+		assert(imp != FLIP(assign));
+		const LIT_ST impVal = values[imp];
+		if (impVal > 0) continue; 
+		const C_REF ref = i->ref();
+		if (cm.deleted(ref)) continue; // deleted binaries are dropped lazily in 'recycleWT'
+		if (impVal) enqueue(imp, level, ref);
+		else { conflict = ref; return true; }
 	}
 	return false;
 }
@@ -175,22 +221,15 @@ inline bool Solver::proplarge(const uint32& assign, const bool& hyper)
 	WATCH* i = ws, * j = i, * wend = ws.end();
 	while (i != wend) {
 		const WATCH w = *j++ = *i++;
+		assert(!w.binary());
 		const uint32 imp = w.imp;
 		CHECKLIT(imp);
 		assert(imp != f_assign);
 		const LIT_ST impVal = values[imp];
 		if (impVal > 0) continue; // blocking literal
-		const C_REF ref = w.ref;
-		//=============== binary ================//
-		if (w.binary()) {
-			if (cm.deleted(ref)) { j--; continue; } // use cm 'stencil' to avoid dereferencing the clause
-			if (impVal) enqueue(imp, level, ref);
-			else { conflict = ref; break; }
-		}
-		//================ large =================//
-		else if (NEQUAL(ref, ignore)) {
+		const C_REF ref = w.ref();
+		if (NEQUAL(ref, ignore)) {
 			ticks++;
-			const C_REF ref = w.ref;
 			if (cm.deleted(ref)) { j--; continue; }
 			CLAUSE& c = cm[ref];
 			assert(c.size() > 2);
@@ -202,17 +241,8 @@ inline bool Solver::proplarge(const uint32& assign, const bool& hyper)
 				(j - 1)->imp = other;
 			else {
 				// === search for (un)-assigned-1 literal to watch
-				uint32* cmid = c.mid(), * cend = c.end();
-				uint32* k = cmid, newlit = 0;
-				LIT_ST _false_ = UNDEFINED;
-				while (k != cend && (_false_ = !values[newlit = *k])) k++;
-				assert(_false_ != UNDEFINED);
-				if (_false_) {
-					k = c + 2;
-					assert(c.pos() <= c.size());
-					while (k != cmid && (_false_ = !values[newlit = *k])) k++;
-				}
-				assert(k >= c + 2 && k <= c.end());
+				uint32 newlit = 0;
+				uint32* k = searchWatch(c, values, newlit);
 				c.set_pos(int(k - c));
 				// ======== end of search ========
 				LIT_ST val = values[newlit];
@@ -236,7 +266,7 @@ inline bool Solver::proplarge(const uint32& assign, const bool& hyper)
 							assert(learntC.empty());
 							learntC.push(dom);
 							learntC.push(other);
-							if (opts.proof_en) proof.addClause(learntC);
+							if (opts.lrat_en) hintChain(ref, learntC, 2);
 							const int csize = c.size();
 							newHyper2(); // 'c' after this line is not valid and cm[ref] should be used if needed
 							delayWatch(f_assign, other, ref, csize), j--;
@@ -0,0 +1,131 @@
+/***********************************************************************[parsebench.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+// Standalone throughput benchmark of the DIMACS tokenizers in 'dimacs.h'.
+// It writes a random CNF file, reads it back into memory and tokenizes it
+// with the scalar reader and each SIMD classifier, reporting GB/s.
+//
+//   build (from 'src/cpu' once 'install.sh' generated its Makefile):
+//     make bench
+//   run:
+//     bench/parsebench [<MB> [<variables> [<repeats> [<path>]]]]
+//
+// Defaults are 256 MB, 1000000 variables, 5 repeats and 'parsebench.cnf'
+// in the working directory, which is removed afterwards unless given.
+
+#include "dimacs.h"
+#include <chrono>
+#include <random>
+
+using namespace ParaFROST;
+
+CNF_INFO ParaFROST::inf;
+
+// writes clauses of 2 to 8 literals until 'bytes' are written and
+// returns the number of clauses
+static uint64 generate(const char* path, const uint64& bytes, const uint32& vars)
+{
+	FILE* out = fopen(path, "w");
+	if (out == NULL) PFLOGE("cannot create '%s'", path);
+	std::mt19937_64 rng(2020);
+	uint64 written = 0, clauses = 0;
+	// the header is rewritten once the clauses are counted
+	written += fprintf(out, "p cnf %-10u %-20llu\n", vars, 0ULL);
+	while (written < bytes) {
+		const int size = 2 + int(rng() % 7);
+		for (int k = 0; k < size; k++) {
+			const uint64 r = rng();
+			const uint32 v = 1 + uint32((r >> 1) % vars);
+			written += fprintf(out, (r & 1) ? "-%u " : "%u ", v);
+		}
+		written += fprintf(out, "0\n");
+		clauses++;
+	}
+	rewind(out);
+	fprintf(out, "p cnf %-10u %-20llu\n", vars, (unsigned long long)clauses);
+	fclose(out);
+	return clauses;
+}
+
+// tokenizes the clauses following the header and returns
+// the sum of all literals read as a checksum
+static uint64 tokenize(char* str, const char* eof, const uint32& vars, CLASSIFIER classify, uint64& nLits)
+{
+	Vec<uint32> org;
+	TOKENIZER tokens(classify);
+	uint64 sum = 0;
+	nLits = 0;
+	eatLine(str);
+	while (true) {
+		eatWS(str);
+		if (str >= eof || !*str) break;
+		org.clear();
+		readClause(str, eof, org, vars, tokens);
+		for (uint32 k = 0; k < org.size(); k++) sum += org[k];
+		nLits += org.size();
+	}
+	return sum;
+}
+
+int main(int argc, char** argv)
+{
+	const uint64 mbytes = argc > 1 ? std::strtoull(argv[1], NULL, 10) : 256;
+	const uint32 vars = argc > 2 ? uint32(std::strtoul(argv[2], NULL, 10)) : 1000000;
+	const int repeats = argc > 3 ? std::atoi(argv[3]) : 5;
+	const char* path = argc > 4 ? argv[4] : "parsebench.cnf";
+	if (!mbytes || !vars || repeats < 1) PFLOGE("expected positive <MB>, <variables> and <repeats>");
+	const uint64 clauses = generate(path, mbytes << 20, vars);
+	FILE* in = fopen(path, "r");
+	if (in == NULL) PFLOGE("cannot open '%s'", path);
+	fseek(in, 0, SEEK_END);
+	const uint64 size = ftell(in);
+	rewind(in);
+	// zero-terminated as the mapped input of the parser
+	char* buffer = pfmalloc<char>(size + 1);
+	if (fread(buffer, 1, size, in) != size) PFLOGE("cannot read '%s'", path);
+	buffer[size] = '\0';
+	fclose(in);
+	if (argc <= 4) remove(path);
+	PRINT("c generated %llu clauses over %u variables in %.1f MB\n",
+		(unsigned long long)clauses, vars, double(size) / MBYTE);
+	struct { const char* name; CLASSIFIER classify; bool available; } tokenizers[] = {
+		{ "scalar", NULL, true },
+#if defined(SIMD_AVX2)
+		{ "sse2", sse2Classify, true },
+		{ "avx2", avx2Classify, bool(__builtin_cpu_supports("avx2")) },
+#endif
+	};
+	uint64 reference = 0;
+	for (auto& t : tokenizers) {
+		if (!t.available) { PRINT("c %-6s not supported by this CPU\n", t.name); continue; }
+		double best = 0;
+		uint64 nLits = 0, sum = 0;
+		for (int r = 0; r < repeats; r++) {
+			const auto start = std::chrono::steady_clock::now();
+			sum = tokenize(buffer, buffer + size, vars, t.classify, nLits);
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			if (!best || elapsed.count() < best) best = elapsed.count();
+		}
+		if (!reference) reference = sum;
+		else if (sum != reference) PFLOGE("%s tokenizer disagrees with the scalar one", t.name);
+		PRINT("c %-6s %.3f GB/s (%llu literals, best of %d in %.3f sec)\n",
+			t.name, double(size) / GBYTE / best, (unsigned long long)nLits, repeats, best);
+	}
+	std::free(buffer);
+	return 0;
+}
@@ -22,6 +22,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "ifthenelse.h"
 #include "redundancy.h"
 #include "subsume.h" 
+#include <thread>
+#include <atomic>
 
 using namespace ParaFROST;
 
@@ -33,117 +35,150 @@ void Solver::bve()
 	if (opts.profile_simp) timer.pstart();
 	Lits_t out_c;
 	out_c.reserve(opts.ve_clause_limit);
+	const uint32 nPVs = PVs.size();
+	const uint32 nchunks = (nPVs + VE_CHUNK_VARS - 1) / VE_CHUNK_VARS;
+	const int nthreads = (int)MIN(uint32(opts.ve_threads), nchunks);
+	if (nthreads <= 1) {
+		VECHUNK chunk;
+		for (uint32 i = 0; i < nPVs; i++) {
+			chunk.clear();
+			planVE(i, chunk, out_c);
+			applyVE(chunk, out_c);
+		}
+	}
+	else {
+		// elected variables share no clauses, so a worker only melts
+		// clauses of its own variables; gate searches may read foreign
+		// clauses but test the molten byte only on their own matches.
+		// Applying the plans in order gives the same formula, model
+		// and proof as one thread
+		PFLOG2(2, "  eliminating %d variables in %d chunks using %d threads", nPVs, nchunks, nthreads);
+		VECHUNK* chunks = new VECHUNK[nchunks];
+		std::atomic<uint32> next(0);
+		auto plan = [this, &next, nchunks, nPVs](VECHUNK* chunks) {
+			Lits_t out_c;
+			out_c.reserve(opts.ve_clause_limit);
+			uint32 c;
+			while ((c = next.fetch_add(1)) < nchunks) {
+				const uint32 end = MIN(nPVs, (c + 1) * VE_CHUNK_VARS);
+				for (uint32 i = c * VE_CHUNK_VARS; i < end; i++)
+					planVE(i, chunks[c], out_c);
+			}
+		};
+		std::thread* workers = new std::thread[nthreads];
+		for (int i = 0; i < nthreads; i++) workers[i] = std::thread(plan, chunks);
+		for (int i = 0; i < nthreads; i++) workers[i].join();
+		delete[] workers;
+		for (uint32 c = 0; c < nchunks; c++) {
+			applyVE(chunks[c], out_c);
+			chunks[c].clear(true);
+		}
+		delete[] chunks;
+	}
+	if (opts.profile_simp) timer.pstop(), timer.ve += timer.pcpuTime();
+}
+
+// decides how to eliminate PVs[i] and records its resolvents in 'chunk';
+// may run on a worker thread, so only the clauses of PVs[i] are written
+inline void Solver::planVE(const uint32& i, VECHUNK& chunk, Lits_t& out_c)
+{
+	const uint32 v = PVs[i];
+	assert(v);
+	assert(!sp->vstate[v].state);
+	const uint32 p = V2L(v), n = NEG(p);
+	OL& poss = ot[p], & negs = ot[n];
+	VEPLAN plan;
+	plan.index = i;
+	countOrgs(poss, plan.pOrgs), countOrgs(negs, plan.nOrgs);
+	// pure-literal
+	if (!plan.pOrgs || !plan.nOrgs) plan.kind = VE_PURE;
+	// Equiv/NOT-gate Reasoning
+	else if ((plan.def = find_BN_gate(p, poss, negs))) plan.kind = VE_INVERTER;
+	else {
+		assert(plan.pOrgs && plan.nOrgs);
+		out_c.clear();
+		const int nOrgCls = plan.pOrgs + plan.nOrgs;
+		int nAddedCls = 0;
+		Byte type = 0;
+		if (nOrgCls > 2) {
+			// AND/OR-gate Reasoning
+			if (find_AO_gate(n, nOrgCls, ot, out_c, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_ANDOR;
+			else if (!nAddedCls && find_AO_gate(p, nOrgCls, ot, out_c, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_ANDOR;
+		}
+		if (!type && nOrgCls > 3) {
+			// ITE-gate Reasoning
+			if (find_ITE_gate(p, nOrgCls, ot, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_ITE;
+			else if (!nAddedCls && find_ITE_gate(n, nOrgCls, ot, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_ITE;
+			// XOR-gate Reasoning
+			else if (find_XOR_gate(p, nOrgCls, ot, out_c, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_XOR;
+			else if (!nAddedCls && find_XOR_gate(n, nOrgCls, ot, out_c, nAddedCls)) type = SUBSTITUTION, plan.kind = VE_XOR;
+		}
+		// n-by-m resolution
+		if (!type && !nAddedCls && !countResolvents(v, nOrgCls, poss, negs, nAddedCls))
+			type = RESOLUTION, plan.kind = VE_RESOLVE;
+		//=======================
+		// resolve or substitute
+		//=======================
+		const uint32 before = chunk.parents.size();
+		if ((type & SUBSTITUTION) && nAddedCls) xsubstitute(v, out_c, chunk);
+		else if ((type & RESOLUTION) && nAddedCls) xresolve(v, out_c, chunk);
+		plan.resolvents = (chunk.parents.size() - before) >> 1;
+	}
+	chunk.plans.push(plan);
+}
+
+// eliminates the variables planned in 'chunk' in order
+inline void Solver::applyVE(VECHUNK& chunk, Lits_t& out_c)
+{
 #ifdef STATISTICS
 	BVESTATS& bvestats = stats.sigma.bve;
 #endif
-	for (uint32 i = 0; i < PVs.size(); i++) {
-		uint32 v = PVs[i];
-		assert(v);
-		assert(!sp->vstate[v].state);
+	const uint32* lits = chunk.lits.data();
+	S_REF* parents = chunk.parents.data();
+	for (uint32 k = 0; k < chunk.plans.size(); k++) {
+		const VEPLAN& plan = chunk.plans[k];
+		if (plan.kind == VE_KEEP) continue;
+		const uint32 v = PVs[plan.index];
 		const uint32 p = V2L(v), n = NEG(p);
 		OL& poss = ot[p], & negs = ot[n];
-		int pOrgs = 0, nOrgs = 0;
-		countOrgs(poss, pOrgs), countOrgs(negs, nOrgs);
-		// pure-literal
-		if (!pOrgs || !nOrgs) {
-			toblivion(p, pOrgs, nOrgs, poss, negs, model);
-#ifdef STATISTICS
-			bvestats.pures++;
-#endif
-			v = 0;
-		}
-		// Equiv/NOT-gate Reasoning
-		else if (uint32 def = find_BN_gate(p, poss, negs)) {
+		if (plan.kind == VE_INVERTER) {
 #ifdef STATISTICS
 			bvestats.inverters++;
 #endif
-			save_BN_gate(p, pOrgs, nOrgs, poss, negs, model);
-			if (substitute_single(p, def, ot)) {
+			save_BN_gate(p, plan.pOrgs, plan.nOrgs, poss, negs, model);
+			if (substitute_single(p, plan.def, ot)) {
 				PFLOG2(2, "  BVE proved a contradiction");
 				learnEmpty();
 				killSolver();
 			}
-			v = 0;
 		}
 		else {
-			assert(pOrgs && nOrgs);
-			out_c.clear();
-			const int nOrgCls = pOrgs + nOrgs;
-			int nAddedCls = 0;
-			Byte type = 0;
-			if (nOrgCls > 2) {
-				// AND/OR-gate Reasoning
-				if (find_AO_gate(n, nOrgCls, ot, out_c, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.andors++;
-					#endif
-				}
-				else if (!nAddedCls && find_AO_gate(p, nOrgCls, ot, out_c, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.andors++;
-					#endif
-				}
-			}
-			if (!type && nOrgCls > 3) {
-				// ITE-gate Reasoning
-				if (find_ITE_gate(p, nOrgCls, ot, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.ites++;
-					#endif
-				}
-				else if (!nAddedCls && find_ITE_gate(n, nOrgCls, ot, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.ites++;
-					#endif
-				}
-				// XOR-gate Reasoning
-				else if (find_XOR_gate(p, nOrgCls, ot, out_c, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.xors++;
-					#endif
-				}
-				else if (!nAddedCls && find_XOR_gate(n, nOrgCls, ot, out_c, nAddedCls)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.xors++;
-					#endif
-				}
-			}
-			// n-by-m resolution
-			if (!type && !nAddedCls && !countResolvents(v, nOrgCls, poss, negs, nAddedCls)) {
-				type = RESOLUTION;
-				#ifdef STATISTICS
-				bvestats.resolutions++;
-				#endif
-			}
-			//=======================
-			// resolve or substitute
-			//=======================
-			if (type & SUBSTITUTION) {
-				if (nAddedCls) xsubstitute(v, out_c);
-				toblivion(p, pOrgs, nOrgs, poss, negs, model);
-				v = 0;
+#ifdef STATISTICS
+			switch (plan.kind) {
+			case VE_PURE: bvestats.pures++; break;
+			case VE_ANDOR: bvestats.andors++; break;
+			case VE_ITE: bvestats.ites++; break;
+			case VE_XOR: bvestats.xors++; break;
+			default: bvestats.resolutions++;
 			}
-			else if (type & RESOLUTION) {
-				if (nAddedCls) xresolve(v, out_c);
-				toblivion(p, pOrgs, nOrgs, poss, negs, model);
-				v = 0;
+#endif
+			for (uint32 r = 0; r < plan.resolvents; r++) {
+				const int size = int(*lits++);
+				out_c.clear();
+				for (int j = 0; j < size; j++) out_c.push(*lits++);
+				newResolvent(out_c, *parents[0], *parents[1]);
+				parents += 2;
 			}
+			toblivion(p, plan.pOrgs, plan.nOrgs, poss, negs, model);
 		}
-		if (!v) {
-			markEliminated(PVs[i]);
-			PVs[i] = 0;
-		}
+		markEliminated(v);
+		PVs[plan.index] = 0;
 	}
-	if (opts.profile_simp) timer.pstop(), timer.ve += timer.pcpuTime();
+	assert(lits == chunk.lits.end());
+	assert(parents == chunk.parents.end());
 }
 
-inline void Solver::xsubstitute(const uint32& x, Lits_t& out_c)
+inline void Solver::xsubstitute(const uint32& x, Lits_t& out_c, VECHUNK& chunk)
 {
 	CHECKVAR(x);
 	PFLOG2(4, " Substituting(%d):", x);
@@ -160,14 +195,14 @@ inline void Solver::xsubstitute(const uint32& x, Lits_t& out_c)
 				if (cj.original()) {
 					const bool b = cj.molten();
 					if (NEQUAL(a, b) && merge(x, ci, cj, out_c))
-						newResolvent(out_c);						
+						chunk.push(out_c, *i, *j);
 				}
 			}
 		}
 	}
 }
 
-inline void Solver::xresolve(const uint32& x, Lits_t& out_c)
+inline void Solver::xresolve(const uint32& x, Lits_t& out_c, VECHUNK& chunk)
 {
 	CHECKVAR(x);
 	PFLOG2(4, " Resolving(%d):", x);
@@ -181,18 +216,18 @@ inline void Solver::xresolve(const uint32& x, Lits_t& out_c)
 			forall_occurs(other, j) {
 				SCLAUSE& cj = **j;
 				if (cj.original() && merge(x, ci, cj, out_c))
-					newResolvent(out_c);
+					chunk.push(out_c, *i, *j);
 			}
 		}
 	}
 }
 
-inline void Solver::newResolvent(const Lits_t& resolvent)
+inline void Solver::newResolvent(const Lits_t& resolvent, const SCLAUSE& ci, const SCLAUSE& cj)
 {
 	const int size = resolvent.size();
 	assert(size);
-	const size_t bytes = hc_scsize + (size - 1) * hc_isize;
-	S_REF added = (S_REF) new Byte[bytes];
+	if (opts.lrat_en) proof.hint(ci.lratid()), proof.hint(cj.lratid());
+	S_REF added = sarena.alloc(size);
 	added->init(resolvent);
 	assert(added->size() == size);
 	assert(added->hasZero() < 0);
@@ -206,6 +241,7 @@ inline void Solver::newResolvent(const Lits_t& resolvent)
 		}
 		else if (!val) {
 			PFLOG2(2, "  BVE proved a contradiction");
+			if (opts.lrat_en) proof.refuteUnit(unit);
 			learnEmpty();
 			killSolver();
 		}
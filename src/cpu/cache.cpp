@@ -0,0 +1,166 @@
+/***********************************************************************[cache.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solver.h"
+#include <sys/stat.h>
+#include <fcntl.h>
+#if defined(__linux__) || defined(__CYGWIN__)
+#include <dirent.h>
+#endif
+
+using namespace ParaFROST;
+
+// kept by value in a 'Vec', so the file name is an
+// offset into a string shared by all entries
+struct CACHE_ENTRY {
+	uint64	size;
+	uint64	used;
+	size_t	name;
+};
+
+struct CACHE_LRU_CMP {
+	const char* names;
+	CACHE_LRU_CMP(const char* names) : names(names) {}
+	inline bool operator () (const CACHE_ENTRY& a, const CACHE_ENTRY& b) const {
+		return a.used < b.used || (a.used == b.used && strcmp(names + a.name, names + b.name) < 0);
+	}
+};
+
+bool CACHE::init(const char* path, const uint64& maxbytes)
+{
+	assert(path && *path);
+#if defined(__linux__) || defined(__CYGWIN__)
+	struct stat st;
+	if (stat(path, &st) && mkdir(path, 0755) && errno != EEXIST) return false;
+	if (stat(path, &st) || !S_ISDIR(st.st_mode) || access(path, R_OK | W_OK | X_OK)) return false;
+	dir.assign(path);
+	if (dir.back() != '/') dir += '/';
+	limit = maxbytes;
+	enabled = true;
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool CACHE::lookup(const uint64& key, const uint64& size)
+{
+	assert(enabled);
+	char name[64];
+	snprintf(name, sizeof(name), "%016llx-%llx" CACHE_SUFFIX, (unsigned long long)key, (unsigned long long)size);
+	entry = dir + name;
+#if defined(__linux__) || defined(__CYGWIN__)
+	struct stat st;
+	missed = stat(entry.c_str(), &st) || !S_ISREG(st.st_mode);
+	// refresh the entry age for eviction
+	if (!missed) utimensat(AT_FDCWD, entry.c_str(), NULL, 0);
+#endif
+	return !missed;
+}
+
+string CACHE::temporary() const
+{
+	assert(pending());
+	char suffix[32];
+	snprintf(suffix, sizeof(suffix), ".%d.tmp", (int)getpid());
+	return entry + suffix;
+}
+
+void CACHE::commit(const string& temporary)
+{
+	assert(pending());
+	// a concurrent writer of the same entry produced the same content
+	if (rename(temporary.c_str(), entry.c_str())) {
+		PFLOGW("cannot move cache entry into \"%s\"", entry.c_str());
+		remove(temporary.c_str());
+	}
+	missed = false;
+	evict();
+}
+
+void CACHE::evict()
+{
+#if defined(__linux__) || defined(__CYGWIN__)
+	DIR* d = opendir(dir.c_str());
+	if (d == NULL) return;
+	Vec<CACHE_ENTRY> entries;
+	string names;
+	uint64 total = 0;
+	const size_t suffixlen = strlen(CACHE_SUFFIX);
+	struct dirent* e;
+	while ((e = readdir(d)) != NULL) {
+		const size_t len = strlen(e->d_name);
+		if (len <= suffixlen || strcmp(e->d_name + len - suffixlen, CACHE_SUFFIX)) continue;
+		const string file = dir + e->d_name;
+		struct stat st;
+		if (stat(file.c_str(), &st) || !S_ISREG(st.st_mode)) continue;
+		const uint64 used = uint64(st.st_mtim.tv_sec) * 1000000000ULL + uint64(st.st_mtim.tv_nsec);
+		entries.push(CACHE_ENTRY { uint64(st.st_size), used, names.size() });
+		names.append(file).push_back('\0');
+		total += st.st_size;
+	}
+	closedir(d);
+	if (total > limit) {
+		std::sort(entries.data(), entries.end(), CACHE_LRU_CMP(names.c_str()));
+		uint32 evicted = 0;
+		for (uint32 i = 0; i < entries.size() && total > limit; i++) {
+			const CACHE_ENTRY& old = entries[i];
+			const char* name = names.c_str() + old.name;
+			// the entry of the current run stays even if it alone exceeds the limit
+			if (entry == name) continue;
+			if (!remove(name)) total -= old.size, evicted++;
+		}
+		PFLOG2(2, "  evicted %d cache entries (%lld MB left)", evicted, total >> 20);
+	}
+#endif
+}
+
+// hashes the whole input before parsing, since a hit must skip the parser;
+// the extra pass reads the file at memory speed (about 3 GB/s) and then
+// leaves it in the page cache for the parser on a miss
+uint64 Solver::cacheKey(const uint64& fsz)
+{
+	uint64 key = CACHESEED;
+#if defined(__linux__) || defined(__CYGWIN__)
+	int fd = open(formula.path.c_str(), O_RDONLY, 0);
+	if (fd == -1) PFLOGE("cannot open input file");
+	void* buffer = mmap(NULL, fsz, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (buffer == MAP_FAILED) PFLOGE("cannot map input file %s", formula.path.c_str());
+	key = cacheHash(key, (const Byte*)buffer, fsz);
+	if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean input file %s mapping", formula.path.c_str());
+	close(fd);
+#endif
+	// everything that shapes the first sigmify
+	const double mapperc = opts.map_perc;
+	uint64 bits;
+	std::memcpy(&bits, &mapperc, sizeof(bits));
+	const uint64 knobs[] = {
+		SNAPVERSION, hc_csize, bits,
+		uint64(opts.phases), uint64(opts.shrink_rate), uint64(opts.xor_max_arity), uint64(opts.ve_clause_limit),
+		uint64(opts.sub_limit), uint64(opts.bce_limit), uint64(opts.ere_limit), uint64(opts.ere_max_resolvent),
+		opts.lcve_min, opts.lits_min, opts.mu_pos, opts.mu_neg,
+		uint64(opts.sigma_priorbins), uint64(opts.lbd_tier1),
+		uint64(opts.decompose_min), uint64(opts.decompose_limit), uint64(opts.decompose_min_eff),
+		uint64(opts.sub_en) | uint64(opts.bce_en) << 1 | uint64(opts.ere_en) << 2 | uint64(opts.all_en) << 3
+		| uint64(opts.aggr_cnf_sort) << 4 | uint64(opts.ve_en) << 5 | uint64(opts.ve_plus_en) << 6
+		| uint64(opts.ve_lbound_en) << 7 | uint64(opts.decompose_en) << 8
+	};
+	for (uint32 i = 0; i < sizeof(knobs) / sizeof(uint64); i++)
+		key = cacheMix(key, knobs[i]);
+	return key;
+}
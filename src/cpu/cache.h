@@ -0,0 +1,87 @@
+/***********************************************************************[cache.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __CACHE_
+#define __CACHE_
+
+#include "definitions.h"
+
+namespace ParaFROST {
+
+	// cache entries are simplified formulas ('snapshot.h')
+	// named by the input hash and size
+	#define CACHE_SUFFIX ".pfs"
+
+	constexpr uint64	CACHESEED		= 0x9E3779B97F4A7C15ULL;
+	constexpr uint64	CACHEPRIME1		= 0x9E3779B185EBCA87ULL;
+	constexpr uint64	CACHEPRIME2		= 0xC2B2AE3D27D4EB4FULL;
+
+	inline uint64 cacheMix(uint64 hash, const uint64& word)
+	{
+		hash ^= word * CACHEPRIME2;
+		hash = (hash << 31) | (hash >> 33);
+		return hash * CACHEPRIME1;
+	}
+
+	// hashes 8 bytes per step, the tail is zero-padded
+	inline uint64 cacheHash(uint64 hash, const Byte* data, const size_t& n)
+	{
+		const Byte* end = data + (n & ~size_t(7));
+		uint64 word;
+		while (data < end) {
+			std::memcpy(&word, data, sizeof(word));
+			hash = cacheMix(hash, word);
+			data += sizeof(word);
+		}
+		if (n & 7) {
+			word = 0;
+			std::memcpy(&word, data, n & 7);
+			hash = cacheMix(hash, word);
+		}
+		return cacheMix(hash, n);
+	}
+
+	/*****************************************************/
+	/*  Usage:   directory of simplified formulas keyed  */
+	/*           by input content and simplifier options */
+	/*           with least-recently-used eviction       */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	class CACHE {
+		string	dir, entry;
+		uint64	limit;
+		bool	enabled, missed;
+
+	public:
+				CACHE		() : limit(0), enabled(false), missed(false) {}
+		// returns false if 'path' cannot be used as a cache directory
+		bool	init		(const char* path, const uint64& maxbytes);
+		// sets the entry of 'key' and returns true on a hit
+		bool	lookup		(const uint64& key, const uint64& size);
+		// moves a written 'temporary' entry into place and evicts old entries
+		void	commit		(const string& temporary);
+		string	temporary	() const;
+		void	evict		();
+		inline	bool			active		() const { return enabled; }
+		inline	bool			pending		() const { return enabled && missed; }
+		inline	const string&	path		() const { return entry; }
+	};
+
+}
+
+#endif
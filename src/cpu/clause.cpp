@@ -48,8 +48,9 @@ void Solver::markSubsume(CLAUSE& c)
 bool Solver::keeping(CLAUSE& c) 
 {
 	if (c.original()) return true;
-	if (c.keep()) return true;
-	if (c.lbd() > limit.keptlbd) return false;
+	const LMETA& m = meta(c);
+	if (m.keep()) return true;
+	if (m.lbd() > limit.keptlbd) return false;
 	if (c.size() > limit.keptsize) return false;
 	return true;
 }
@@ -61,6 +62,7 @@ void Solver::removeClause(CLAUSE& c, const C_REF& cref)
 	assert(c.size() > 1);
 	const int size = c.size();
 	if (c.learnt()) {
+		meta(c).markDead();
 		assert(stats.clauses.learnt > 0);
 		stats.clauses.learnt--;
 		assert(stats.literals.learnt > 0);
@@ -88,9 +90,10 @@ void Solver::newClause(const C_REF& cref, CLAUSE& c, const bool& learnt)
 		assert(sp->learntLBD > 0);
 		int trimlbd = sp->learntLBD > size ? size : sp->learntLBD;
 		c.markLearnt();
-		c.set_lbd(trimlbd);
-		c.set_usage(1 + (sp->learntLBD <= opts.lbd_tier2));
-		if (size > 2 && trimlbd > opts.lbd_tier1) c.set_keep(0);
+		LMETA& m = attachMeta(cref, c);
+		m.set_lbd(trimlbd);
+		m.set_usage(1 + (sp->learntLBD <= opts.lbd_tier2));
+		if (size > 2 && trimlbd > opts.lbd_tier1) m.set_keep(0);
 		learnts.push(cref);
 		stats.clauses.learnt++;
 		stats.literals.learnt += size;
@@ -108,10 +111,9 @@ C_REF Solver::newClause(const Lits_t& in_c, const bool& learnt)
 {
 	const C_REF r = cm.alloc(in_c);
 	CLAUSE& c = cm[r];
-	assert(c.keep());
 	assert(!c.deleted());
-	attachWatch(r, c);
 	newClause(r, c, learnt);
+	attachWatch(r, c);
 	return r;
 }
 
@@ -121,12 +123,13 @@ void Solver::newHyper2()
 	stats.binary.resolvents++;
 	const C_REF r = cm.alloc(learntC);
 	CLAUSE& c = cm[r];
+	if (opts.proof_en) proof.addClause(c);
 	const uint32 first = c[0], second = c[1];
 	delayWatch(first, second, r, 2);
 	delayWatch(second, first, r, 2);
 	sp->learntLBD = 2;
 	newClause(r, c, true);
-	c.markHyper();
+	meta(c).markHyper();
 	learntC.clear();
 }
 
@@ -137,9 +140,10 @@ void Solver::newHyper3(const bool& learnt)
 	last.ternary.resolvents++;
 	const C_REF r = cm.alloc(learntC);
 	CLAUSE& c = cm[r];
+	if (opts.proof_en) proof.addClause(c);
 	sp->learntLBD = size;
 	newClause(r, c, learnt);
-	if (learnt) c.markHyper();
+	if (learnt) meta(c).markHyper();
 	attachClause(r, c);
 	PFLCLAUSE(4, c, "  added new hyper ternary resolvent");
 }
@@ -41,74 +41,55 @@ namespace ParaFROST {
 	class CLAUSE {
 		bool	_l : 1;
 		bool	_d : 1;
-		bool	_r : 1;
 		bool	_m : 1;
 		bool	_s : 1;
-		bool	_h : 1;
-		bool	_k : 1;
 		bool	_b : 1;
 		bool	_v;
-		CL_ST	_used; 
-		int		_sz, _pos, _lbd;
+		int		_sz, _pos;
+		uint32	_id;
 		union { uint32 _lits[2]; C_REF _ref; };
 	public:
 		size_t capacity() const { return (size_t(_sz) - 2) * sizeof(uint32) + sizeof(*this); }
 		inline CLAUSE() :
 			  _l(false)
 			, _d(false)
-			, _r(false)
 			, _m(false)
 			, _s(false)
-			, _h(false)
-			, _k(true)
 			, _b(false)
 			, _v(false)
-			, _used(0)
 			, _sz(0)
 			, _pos(2)
-			, _lbd(0)
+			, _id(NOID)
 		{ }
 		inline CLAUSE(const int& size) : 
 			  _l(false)
 			, _d(false)
-			, _r(false)
 			, _m(false)
 			, _s(false)
-			, _h(false)
-			, _k(true)
 			, _v(false)
-			, _used(0)
 			, _sz(size)
 			, _pos(2)
-			, _lbd(0)
+			, _id(NOID)
 		{ assert(_sz > 1); _b = _sz == 2; }
 		inline CLAUSE(const Lits_t& lits) : 
 			  _l(false)
 			, _d(false)
-			, _r(false)
 			, _m(false)
 			, _s(false)
-			, _h(false)
-			, _k(true)
 			, _v(false)
-			, _used(0)
 			, _sz(lits.size())
 			, _pos(2)
-			, _lbd(0)
+			, _id(NOID)
 		{ assert(_sz > 1); _b = _sz == 2; copyLitsFrom(lits); }
 		inline CLAUSE(const CLAUSE& src) : 
 			  _l(src.learnt())
 			, _d(src.deleted())
-			, _r(src.reason())
 			, _m(false)
 			, _s(src.subsume())
-			, _h(src.hyper())
-			, _k(src.keep())
 			, _v(src.vivify())
-			, _used(src.usage())
 			, _sz(src.size())
 			, _pos(src.pos())
-			, _lbd(src.lbd())
+			, _id(src.id())
 		{ assert(_sz > 1); _b = _sz == 2; copyLitsFrom(src); }
 		template <class SRC>
 		inline	void		copyLitsFrom(const SRC& src) {
@@ -127,31 +108,23 @@ namespace ParaFROST {
 		inline	void		pop			() { assert(_sz); _sz--, _b = _sz == 2; }
 		inline	C_REF		ref			() const { assert(_m); return _ref; }
 		inline	int			pos			() const { assert(_pos > 1); return _pos; }
-		inline	CL_ST		usage		() const { assert(_used < USAGET1); return _used; }
 		inline	int			size		() const { return _sz; }
-		inline	int			lbd			() const { return _lbd; }
+		inline	uint32		id			() const { return _id; }
+		// the LRAT id precedes clauses of a 'CMM' storing ids
+		inline	uint64		lratid		() const { return ((const uint64*)this)[-1]; }
 		inline	bool		original	() const { return !_l; }
 		inline	bool		learnt		() const { return _l; }
 		inline	bool		deleted		() const { return _d; }
-		inline	bool		reason		() const { return _r; }
 		inline	bool		moved		() const { return _m; }
 		inline	bool		subsume		() const { return _s; }
 		inline	bool		vivify		() const { return _v; }
-		inline	bool		keep		() const { return _k; }
-		inline	bool		hyper		() const { return _h; }
 		inline	bool		binary		() const { assert(_sz > 2 || _b); return _b; }
-		inline	void		initTier2	() { _used = USAGET2; }
-		inline	void		initTier3	() { _used = USAGET3; }
-		inline	void		warm		() { assert(_used); _used--; }
 		inline  void		initMoved	() { _m = false; }
-		inline	void		initReason	() { _r = false; }
 		inline	void		initSubsume	() { _s = false; }
 		inline	void		initVivify	() { _v = false; }
 		inline	void		markOriginal() { _l = false; }
 		inline	void		markLearnt	() { _l = true; }
-		inline	void		markReason	() { _r = true; }
 		inline	void		markMoved	() { _m = true; }
-		inline	void		markHyper	() { _h = true; }
 		inline	void		markSubsume	() { _s = true; }
 		inline	void		markVivify	() { _v = true; }
 		inline	void		markDeleted	() { _d = true; }
@@ -167,9 +140,8 @@ namespace ParaFROST {
 		}
 		inline	void		set_ref		(const C_REF& r) { _m = 1, _ref = r; }
 		inline	void		set_pos		(const int& newPos) { assert(newPos >= 2); _pos = newPos; }
-		inline	void		set_lbd		(const int& lbd) { _lbd = lbd; }
-		inline	void		set_usage	(const CL_ST& usage) { _used = usage; }
-		inline	void		set_keep	(const bool& keep) { _k = keep; }
+		inline	void		set_id		(const uint32& id) { _id = id; }
+		inline	void		set_lratid	(const uint64& id) { ((uint64*)this)[-1] = id; }
 		inline	void		print		() const {
 			PRINT("(");
 			for (int l = 0; l < _sz; l++) {
@@ -181,13 +153,45 @@ namespace ParaFROST {
 			if (deleted()) st = 'X';
 			else if (original()) st = 'O';
 			else if (learnt()) st = 'L';
-			PRINT(") %c:%d[u:%d k:%d h:%d lbd:%d]\n", 
-				st, reason(), usage(), keep(), hyper(), lbd());
+			PRINT(") %c[id:%d]\n", st, _id);
 		}
 	};
 	const size_t hc_isize = sizeof(uint32);
 	const size_t hc_csize = sizeof(CLAUSE);
 
+	/*****************************************************/
+	/*  Usage:   learnt clause metadata kept outside     */
+	/*           the clause arena, indexed by 'CLAUSE::id'*/
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	class LMETA {
+		C_REF	_ref;
+		int		_lbd;
+		CL_ST	_used;
+		bool	_k, _h, _r;
+	public:
+		inline LMETA() : _ref(NOREF), _lbd(0), _used(0), _k(true), _h(false), _r(false) { }
+		inline LMETA(const C_REF& ref) : _ref(ref), _lbd(0), _used(0), _k(true), _h(false), _r(false) { }
+		inline	C_REF		ref			() const { return _ref; }
+		inline	bool		dead		() const { return _ref == NOREF; }
+		inline	int			lbd			() const { return _lbd; }
+		inline	CL_ST		usage		() const { assert(_used < USAGET1); return _used; }
+		inline	bool		keep		() const { return _k; }
+		inline	bool		hyper		() const { return _h; }
+		inline	bool		reason		() const { return _r; }
+		inline	void		initTier2	() { _used = USAGET2; }
+		inline	void		initTier3	() { _used = USAGET3; }
+		inline	void		warm		() { assert(_used); _used--; }
+		inline	void		initReason	() { _r = false; }
+		inline	void		markReason	() { _r = true; }
+		inline	void		markHyper	() { _h = true; }
+		inline	void		markDead	() { _ref = NOREF; }
+		inline	void		set_ref		(const C_REF& ref) { _ref = ref; }
+		inline	void		set_lbd		(const int& lbd) { _lbd = lbd; }
+		inline	void		set_usage	(const CL_ST& usage) { _used = usage; }
+		inline	void		set_keep	(const bool& keep) { _k = keep; }
+	};
+
 #if defined(_WIN32)
 #pragma warning(pop)
 #elif defined(__linux__) || defined(__CYGWIN__)
@@ -33,6 +33,12 @@ namespace ParaFROST {
 	#define GBYTE			0x40000000
 	#define NOREF			UINT64_MAX
 	#define NOVAR			UINT32_MAX
+	#define NOID			UINT32_MAX
+	#define MAX_WREF		0x200000000ULL
+	#define W_REF_MASK		0xFFFFFFFEU
+	#define W_REF(x)		(uint32((x) >> 1) & W_REF_MASK)
+	#define STENCIL_WORD(x)	((x) >> 8)
+	#define STENCIL_BIT(x)	(1ULL << (((x) >> 2) & 63))
 	#define INIT_CAP		32
 	#define UNDEFINED		-1
 	#define ORGPHASE		1
@@ -52,8 +58,8 @@ namespace ParaFROST {
 	#define NEG_SIGN		0x00000001
 	#define HASH_MASK		0x0000001F
 	#define MAX_DLC			0x00000003
-	#define MAX_LBD			0x04000000UL
-	#define MAX_LBD_M		0x03FFFFFFUL
+	#define MAX_LBD			0x00080000UL
+	#define MAX_LBD_M		0x0007FFFFUL
 	#define NOVAL_MASK		(LIT_ST)-2
 	#define VAL_MASK		(LIT_ST) 1
 	#define MELTED_M		(LIT_ST)0x01
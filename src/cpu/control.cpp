@@ -200,10 +200,51 @@ namespace ParaFROST {
 		PFLOG2(1, " Available system memory: %lld GB", _free / GBYTE);
 	}
 
+	bool hasAVX2()
+	{
+#if defined(__CYGWIN__)
+		return false;
+#else
+		int CPUInfo[4] = { 0, 0, 0, 0 };
+#if defined(_WIN32)
+		__cpuid(CPUInfo, 0);
+#elif defined(__linux__)
+		__cpuid(0, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3]);
+#endif
+		if (CPUInfo[0] < 7) return false;
+#if defined(_WIN32)
+		__cpuid(CPUInfo, 1);
+#elif defined(__linux__)
+		__cpuid(1, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3]);
+#endif
+		// AVX and OSXSAVE must be set before reading XCR0
+		const uint32 avxmask = (1U << 27) | (1U << 28);
+		if ((uint32(CPUInfo[2]) & avxmask) != avxmask) return false;
+#if defined(_WIN32)
+		const uint64 xcr0 = _xgetbv(0);
+#elif defined(__linux__)
+		uint32 xlo = 0, xhi = 0;
+		__asm__ __volatile__("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+		const uint64 xcr0 = (uint64(xhi) << 32) | xlo;
+#endif
+		// OS must save both XMM and YMM states
+		if ((xcr0 & 6) != 6) return false;
+#if defined(_WIN32)
+		__cpuidex(CPUInfo, 7, 0);
+#elif defined(__linux__)
+		__cpuid_count(7, 0, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3]);
+#endif
+		return uint32(CPUInfo[1]) & (1U << 5);
+#endif
+	}
+
 	void getBuildInfo()
 	{
 		PFLOG1(" Built on %s%s%s at %s%s%s", CREPORTVAL, osystem(), CNORMAL, CREPORTVAL, date(), CNORMAL);
 		PFLOG1("       using %s%s %s%s", CREPORTVAL, compiler(), compilemode(), CNORMAL);
+#if defined(HOTSP)
+		PFLOG1("       with %sinterleaved search space (HOTSP)%s", CREPORTVAL, CNORMAL);
+#endif
 	}
 
 }
@@ -211,6 +252,7 @@ namespace ParaFROST {
 void ParaFROST::Solver::killSolver()
 {
 	wrapup();
+	if (opts.proof_en) proof.close();
 	PFLOG0("");
 	PFLOGN2(1, " Cleaning up..");
 	this->~Solver();
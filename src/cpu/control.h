@@ -30,6 +30,7 @@ namespace ParaFROST {
 	int64	getAvailSysMem			();
 	void	getBuildInfo			();
 	void	getCPUInfo				(uint64&);
+	bool	hasAVX2					();
 	void	signal_handler			(void h_intr(int), void h_timeout(int) = NULL);
 	void	set_timeout				(int);
 	void	set_memoryout			(int);
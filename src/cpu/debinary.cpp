@@ -23,7 +23,7 @@ void Solver::debinary() {
 	if (!opts.debinary_en) return;
 	if (!cnfstate) return;
 	assert(!DL());
-	assert(!wt.empty());
+	assert(!bt.empty());
 	assert(sp->propagated == trail.size());
 	stats.debinary.calls++;
 	uVec1D& marked = minimized;
@@ -32,52 +32,57 @@ void Solver::debinary() {
 		assert(marked.empty());
 		if (inactive(lit)) continue;
 		uint32 unit = 0;
-		WL& ws = wt[lit];
-		WATCH *j = ws;
-		forall_watches(ws, i) {
-			const WATCH w = *j++ = *i;
-			const C_REF cref = w.ref;
+		BL& bs = bt[lit];
+		BWATCH *j = bs;
+		forall_bwatches(bs, i) {
+			const BWATCH w = *j++ = *i;
+			const C_REF cref = w.ref();
 			if (cm.deleted(cref)) { j--; continue; }
-			if (w.binary()) {
-				const uint32 other = w.imp;
-				CHECKLIT(other);
-				const LIT_ST marker = l2marker(other);
-				CLAUSE& c = cm[cref];
-				assert(c.size() == 2);
-				if (UNASSIGNED(marker)) {
-					markLit(other);
-					marked.push(other);
-				}
-				else if (NEQUAL(marker, SIGN(other))) { // found 'hyper unary'
-					unit = FLIP(lit);
-					j = ws; // the whole list is satisfied by 'unit'
-					units++;
-					break;
+			const uint32 other = w.imp;
+			CHECKLIT(other);
+			const LIT_ST marker = l2marker(other);
+			CLAUSE& c = cm[cref];
+			assert(c.size() == 2);
+			if (UNASSIGNED(marker)) {
+				markLit(other);
+				marked.push(other);
+			}
+			else if (NEQUAL(marker, SIGN(other))) { // found 'hyper unary'
+				unit = FLIP(lit);
+				if (opts.lrat_en) {
+					const uint32 fother = FLIP(other);
+					BWATCH* k = bs;
+					while (k->imp != fother || cm.deleted(k->ref())) k++;
+					assert(k < j - 1);
+					proof.hint(c.lratid()), proof.hint(cm[k->ref()].lratid());
 				}
-				else { // found duplicate
-					PFLCLAUSE(4, c, "  found duplicated binary");
-					if (c.original()) { // find learnt duplicate if exists
-						for (WATCH* k = ws; ; k++) {
-							assert(k != i);
-							if (!k->binary() || NEQUAL(k->imp, other)) continue;
-							const C_REF dref = k->ref;
-							if (cm.deleted(dref)) continue;
-							assert(cm[dref].size() == 2);
-							assert(!cm[dref].deleted());
-							removeClause(cm[dref], dref);
-							*k = w;
-							break;
-						}
+				j = bs; // the whole list is satisfied by 'unit'
+				units++;
+				break;
+			}
+			else { // found duplicate
+				PFLCLAUSE(4, c, "  found duplicated binary");
+				if (c.original()) { // find learnt duplicate if exists
+					for (BWATCH* k = bs; ; k++) {
+						assert(k != i);
+						if (NEQUAL(k->imp, other)) continue;
+						const C_REF dref = k->ref();
+						if (cm.deleted(dref)) continue;
+						assert(cm[dref].size() == 2);
+						assert(!cm[dref].deleted());
+						removeClause(cm[dref], dref);
+						*k = w;
+						break;
 					}
-					else
-						removeClause(c, cref);
-					subsumed++;
-					j--;
 				}
+				else
+					removeClause(c, cref);
+				subsumed++;
+				j--;
 			}
 		}
-		if (j != ws) ws.resize(int(j - ws));
-		else ws.clear(true);
+		if (j != bs) bs.resize(int(j - bs));
+		else bs.clear(true);
 		forall_vector(uint32, marked, i) { unmarkLit(*i); }
 		marked.clear();
 		if (unit) {
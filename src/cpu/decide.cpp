@@ -22,7 +22,7 @@ using namespace ParaFROST;
 uint32 Solver::nextVSIDS()
 {
 	assert(inf.unassigned);
-	VSTATE* states = sp->vstate;
+	VSTATES states = sp->vstate;
 	uint32 cand = 0;
 	while (!vsids.empty()) {
 		cand = vsids.top();
@@ -38,7 +38,7 @@ uint32 Solver::nextVSIDS()
 uint32 Solver::nextVMFQ()
 {
 	assert(inf.unassigned);
-	VSTATE* states = sp->vstate;
+	VSTATES states = sp->vstate;
 	uint32 free = vmtf.free();
 	assert(free);
 	if (states[free].state || !UNASSIGNED(sp->value[V2L(free)])) {
@@ -0,0 +1,372 @@
+/***********************************************************************[decompress.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "decompress.h"
+
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+#if defined(HAVE_LZMA)
+#include <lzma.h>
+#endif
+#if defined(HAVE_BZIP2)
+#include <bzlib.h>
+#endif
+#if defined(HAVE_ZSTD)
+#include <zstd.h>
+#endif
+
+using namespace ParaFROST;
+
+// compressed bytes read at once by the worker
+#define DECODE_INPUT (1ULL << 18)
+
+CODEC ParaFROST::detectCodec(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) return NOCODEC;
+	Byte magic[6] = { 0 };
+	const size_t n = fread(magic, 1, sizeof(magic), file);
+	fclose(file);
+	if (n >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) return GZIP;
+	if (n >= 6 && magic[0] == 0xFD && magic[1] == '7' && magic[2] == 'z' && magic[3] == 'X' && magic[4] == 'Z' && magic[5] == 0) return XZ;
+	if (n >= 3 && magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h') return BZIP2;
+	if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD) return ZSTD;
+	return NOCODEC;
+}
+
+CODEC ParaFROST::suffixCodec(const char* path)
+{
+	const char* dot = strrchr(path, '.');
+	if (dot == NULL) return NOCODEC;
+	if (!strcmp(dot, ".gz")) return GZIP;
+	if (!strcmp(dot, ".xz")) return XZ;
+	if (!strcmp(dot, ".bz2")) return BZIP2;
+	if (!strcmp(dot, ".zst")) return ZSTD;
+	return NOCODEC;
+}
+
+const char* ParaFROST::codecName(const CODEC& codec)
+{
+	switch (codec) {
+	case GZIP: return "gzip";
+	case XZ: return "xz";
+	case BZIP2: return "bzip2";
+	case ZSTD: return "zstd";
+	default: return "plain";
+	}
+}
+
+bool ParaFROST::codecAvailable(const CODEC& codec)
+{
+	switch (codec) {
+#if defined(HAVE_ZLIB)
+	case GZIP: return true;
+#endif
+#if defined(HAVE_LZMA)
+	case XZ: return true;
+#endif
+#if defined(HAVE_BZIP2)
+	case BZIP2: return true;
+#endif
+#if defined(HAVE_ZSTD)
+	case ZSTD: return true;
+#endif
+	default: return false;
+	}
+}
+
+bool ParaFROST::codecEncodes(const CODEC& codec)
+{
+	return (codec == GZIP || codec == ZSTD) && codecAvailable(codec);
+}
+
+DECODER::DECODER(const string& path, const CODEC& codec) :
+	path(path)
+	, codec(codec)
+	, head(0)
+	, tail(0)
+	, count(0)
+	, done(false)
+	, stopped(false)
+{
+	assert(codecAvailable(codec));
+	for (int i = 0; i < DECODE_BLOCKS; i++) {
+		blocks[i].data = pfmalloc<char>(DECODE_BLOCK);
+		blocks[i].size = blocks[i].pos = 0;
+	}
+	worker = std::thread(&DECODER::decode, this);
+}
+
+DECODER::~DECODER()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopped = true;
+	}
+	drained.notify_all();
+	worker.join();
+	for (int i = 0; i < DECODE_BLOCKS; i++)
+		std::free(blocks[i].data);
+}
+
+int64 DECODER::read(char* buffer, const size_t& n)
+{
+	std::unique_lock<std::mutex> guard(lock);
+	filled.wait(guard, [this] { return count > 0 || done; });
+	if (!count) {
+		if (!failure.empty()) PFLOGE("%s", failure.c_str());
+		return 0;
+	}
+	// the head block is not touched by the worker while it is counted
+	BLOCK& block = blocks[head];
+	guard.unlock();
+	assert(block.pos < block.size);
+	const size_t bytes = MIN(n, block.size - block.pos);
+	std::memcpy(buffer, block.data + block.pos, bytes);
+	block.pos += bytes;
+	if (block.pos == block.size) {
+		guard.lock();
+		head = (head + 1) % DECODE_BLOCKS;
+		count--;
+		guard.unlock();
+		drained.notify_one();
+	}
+	return int64(bytes);
+}
+
+DECODER::BLOCK* DECODER::freeBlock()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	drained.wait(guard, [this] { return count < DECODE_BLOCKS || stopped; });
+	if (stopped) return NULL;
+	BLOCK* block = blocks + tail;
+	block->size = block->pos = 0;
+	return block;
+}
+
+void DECODER::publish()
+{
+	assert(blocks[tail].size);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		tail = (tail + 1) % DECODE_BLOCKS;
+		count++;
+	}
+	filled.notify_one();
+}
+
+void DECODER::fail(const char* msg)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (failure.empty()) failure = msg;
+}
+
+void DECODER::decode()
+{
+	switch (codec) {
+	case GZIP: gunzip(); break;
+	case XZ: unxz(); break;
+	case BZIP2: bunzip(); break;
+	case ZSTD: unzstd(); break;
+	default: fail("unsupported compression format");
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		done = true;
+	}
+	filled.notify_all();
+}
+
+void DECODER::gunzip()
+{
+#if defined(HAVE_ZLIB)
+	gzFile in = gzopen(path.c_str(), "rb");
+	if (in == NULL) { fail("cannot open gzip input file"); return; }
+	gzbuffer(in, DECODE_INPUT);
+	BLOCK* block = NULL;
+	while ((block = freeBlock()) != NULL) {
+		const int bytes = gzread(in, block->data, DECODE_BLOCK);
+		if (bytes < 0) {
+			int err = 0;
+			fail(gzerror(in, &err));
+			break;
+		}
+		if (!bytes) {
+			int err = 0;
+			gzerror(in, &err);
+			if (err == Z_BUF_ERROR) fail("unexpected end of gzip input file");
+			break;
+		}
+		block->size = bytes;
+		publish();
+	}
+	gzclose(in);
+#endif
+}
+
+void DECODER::unxz()
+{
+#if defined(HAVE_LZMA)
+	FILE* in = fopen(path.c_str(), "rb");
+	if (in == NULL) { fail("cannot open xz input file"); return; }
+	lzma_stream strm = LZMA_STREAM_INIT;
+	if (lzma_stream_decoder(&strm, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+		fail("cannot initialize xz decoder");
+		fclose(in);
+		return;
+	}
+	uint8_t* input = pfmalloc<uint8_t>(DECODE_INPUT);
+	lzma_action action = LZMA_RUN;
+	BLOCK* block = NULL;
+	while (true) {
+		if (block == NULL) {
+			if ((block = freeBlock()) == NULL) break;
+			strm.next_out = (uint8_t*)block->data;
+			strm.avail_out = DECODE_BLOCK;
+		}
+		if (!strm.avail_in && action == LZMA_RUN) {
+			strm.next_in = input;
+			strm.avail_in = fread(input, 1, DECODE_INPUT, in);
+			if (ferror(in)) { fail("cannot read xz input file"); break; }
+			if (feof(in)) action = LZMA_FINISH;
+		}
+		const lzma_ret ret = lzma_code(&strm, action);
+		if (!strm.avail_out || ret == LZMA_STREAM_END) {
+			block->size = DECODE_BLOCK - strm.avail_out;
+			if (block->size) publish();
+			block = NULL;
+		}
+		if (ret == LZMA_STREAM_END) break;
+		if (ret != LZMA_OK) { fail("corrupted xz input file"); break; }
+	}
+	std::free(input);
+	lzma_end(&strm);
+	fclose(in);
+#endif
+}
+
+void DECODER::bunzip()
+{
+#if defined(HAVE_BZIP2)
+	FILE* in = fopen(path.c_str(), "rb");
+	if (in == NULL) { fail("cannot open bzip2 input file"); return; }
+	bz_stream strm;
+	std::memset(&strm, 0, sizeof(strm));
+	if (BZ2_bzDecompressInit(&strm, 0, 0) != BZ_OK) {
+		fail("cannot initialize bzip2 decoder");
+		fclose(in);
+		return;
+	}
+	char* input = pfmalloc<char>(DECODE_INPUT);
+	bool eof = false, finished = false;
+	BLOCK* block = NULL;
+	while (!finished) {
+		if (block == NULL) {
+			if ((block = freeBlock()) == NULL) break;
+			strm.next_out = block->data;
+			strm.avail_out = DECODE_BLOCK;
+		}
+		if (!strm.avail_in && !eof) {
+			strm.next_in = input;
+			strm.avail_in = (unsigned)fread(input, 1, DECODE_INPUT, in);
+			if (ferror(in)) { fail("cannot read bzip2 input file"); break; }
+			eof = feof(in);
+		}
+		const int ret = BZ2_bzDecompress(&strm);
+		if (ret == BZ_STREAM_END) {
+			// concatenated streams restart the decoder on the remaining input
+			if (!strm.avail_in && !eof) {
+				strm.next_in = input;
+				strm.avail_in = (unsigned)fread(input, 1, DECODE_INPUT, in);
+				eof = feof(in);
+			}
+			if (strm.avail_in) {
+				char* next_in = strm.next_in, * next_out = strm.next_out;
+				const unsigned avail_in = strm.avail_in, avail_out = strm.avail_out;
+				BZ2_bzDecompressEnd(&strm);
+				std::memset(&strm, 0, sizeof(strm));
+				if (BZ2_bzDecompressInit(&strm, 0, 0) != BZ_OK) { fail("cannot initialize bzip2 decoder"); break; }
+				strm.next_in = next_in, strm.avail_in = avail_in;
+				strm.next_out = next_out, strm.avail_out = avail_out;
+			}
+			else finished = true;
+		}
+		else if (ret != BZ_OK) { fail("corrupted bzip2 input file"); break; }
+		else if (eof && !strm.avail_in && strm.avail_out) { fail("unexpected end of bzip2 input file"); break; }
+		if (!strm.avail_out || finished) {
+			block->size = DECODE_BLOCK - strm.avail_out;
+			if (block->size) publish();
+			block = NULL;
+		}
+	}
+	std::free(input);
+	BZ2_bzDecompressEnd(&strm);
+	fclose(in);
+#endif
+}
+
+void DECODER::unzstd()
+{
+#if defined(HAVE_ZSTD)
+	FILE* in = fopen(path.c_str(), "rb");
+	if (in == NULL) { fail("cannot open zstd input file"); return; }
+	ZSTD_DStream* strm = ZSTD_createDStream();
+	if (strm == NULL || ZSTD_isError(ZSTD_initDStream(strm))) {
+		fail("cannot initialize zstd decoder");
+		fclose(in);
+		return;
+	}
+	char* input = pfmalloc<char>(DECODE_INPUT);
+	ZSTD_inBuffer src = { input, 0, 0 };
+	ZSTD_outBuffer dst = { NULL, 0, 0 };
+	size_t last = 0;
+	bool flushing = false, stop = false;
+	BLOCK* block = NULL;
+	while (!stop) {
+		if (src.pos == src.size && !flushing) {
+			src.size = fread(input, 1, DECODE_INPUT, in), src.pos = 0;
+			if (ferror(in)) { fail("cannot read zstd input file"); break; }
+			if (!src.size) break;
+		}
+		// a full output block may leave decoded bytes inside the decoder
+		while (src.pos < src.size || flushing) {
+			if (block == NULL) {
+				if ((block = freeBlock()) == NULL) { stop = true; break; }
+				dst.dst = block->data, dst.size = DECODE_BLOCK, dst.pos = 0;
+			}
+			last = ZSTD_decompressStream(strm, &dst, &src);
+			if (ZSTD_isError(last)) { fail(ZSTD_getErrorName(last)); stop = true; break; }
+			flushing = (dst.pos == dst.size);
+			if (flushing) {
+				block->size = dst.pos;
+				publish();
+				block = NULL;
+			}
+		}
+	}
+	if (block != NULL && dst.pos) {
+		block->size = dst.pos;
+		publish();
+	}
+	if (!stop && last) fail("unexpected end of zstd input file");
+	std::free(input);
+	ZSTD_freeDStream(strm);
+	fclose(in);
+#endif
+}
@@ -0,0 +1,78 @@
+/***********************************************************************[decompress.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __DECOMPRESS_
+#define __DECOMPRESS_
+
+#include "dimacs.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ParaFROST {
+
+	enum CODEC { NOCODEC = 0, GZIP, XZ, BZIP2, ZSTD };
+
+	// decompressed blocks in flight between the decoder and the parser
+	constexpr int		DECODE_BLOCKS	= 4;
+	constexpr size_t	DECODE_BLOCK	= (1ULL << 20);
+
+	// detect a compressed file by its magic bytes
+	CODEC		detectCodec		(const char* path);
+	// codec of a file to be written by its suffix
+	CODEC		suffixCodec		(const char* path);
+	const char*	codecName		(const CODEC& codec);
+	bool		codecAvailable	(const CODEC& codec);
+	// only gzip and zstd have encoders
+	bool		codecEncodes	(const CODEC& codec);
+
+	/*****************************************************/
+	/*  Usage:   decompresses a file on its own thread   */
+	/*           into a bounded ring of blocks           */
+	/*  Dependency:  DSOURCE                             */
+	/*****************************************************/
+	class DECODER : public DSOURCE {
+		struct BLOCK { char* data; size_t size, pos; };
+		BLOCK		blocks[DECODE_BLOCKS];
+		std::thread	worker;
+		std::mutex	lock;
+		std::condition_variable	filled, drained;
+		string		path, failure;
+		CODEC		codec;
+		int			head, tail, count;
+		bool		done, stopped;
+
+		// called by the worker
+		BLOCK*	freeBlock		();
+		void	publish			();
+		void	fail			(const char* msg);
+		void	decode			();
+		void	gunzip			();
+		void	unxz			();
+		void	bunzip			();
+		void	unzstd			();
+
+	public:
+				DECODER			(const string& path, const CODEC& codec);
+				~DECODER		();
+		int64	read			(char* buffer, const size_t& n);
+	};
+
+}
+
+#endif
@@ -33,6 +33,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <cstdint>
 #include <cstdlib>
 #include <csignal>
+#include <chrono>
 #include "logging.h"
 #include "datatypes.h"
 #include "constants.h"
@@ -83,10 +84,14 @@ namespace ParaFROST {
 	private:
 		clock_t _start, _stop;
 		clock_t _start_p, _stop_p;
+		int64 _wstart, _wstop; // steady-clock nanoseconds
 		float _cpuTime;
+		static int64 wallClock	() {
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
 	public:
 		float parse, solve, simp;
-		float vo, ve, sub, bce, ere, cot, rot, sot, gc, io;
+		float vo, ve, sub, bce, ere, cot, rot, sot, gc, io, reduce, lrat;
 		TIMER			() { RESETSTRUCT(this); }
 		void start		() { _start = clock(); }
 		void stop		() { _stop = clock(); }
@@ -94,6 +99,10 @@ namespace ParaFROST {
 		void pstart		() { _start_p = clock(); }
 		void pstop		() { _stop_p = clock(); }
 		float pcpuTime	() { return _cpuTime = (((float)abs(_stop_p - _start_p)) / CLOCKS_PER_SEC) * float(1000.0); }
+		// elapsed real time in seconds, which unlike 'clock' does not add up helper threads
+		void wstart		() { _wstart = wallClock(); }
+		void wstop		() { _wstop = wallClock(); }
+		float wallTime	() const { return float(double(_wstop - _wstart) * 1e-9); }
 	};
 	//====================================================//
 	//                 iterators & checkers               //
@@ -19,6 +19,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "solver.h"
 #include "dimacs.h"
 #include "control.h"
+#include "decompress.h"
+#include <thread>
 
 using namespace ParaFROST;
 
@@ -39,7 +41,25 @@ bool Solver::parser()
 	struct stat st;
 	bool readfile = canAccess(formula.path.c_str(), st);
 	const uint64 fsz = formula.size = st.st_size;
-	if (readfile)
+	const bool snapshot = readfile && isSnapshot(formula.path.c_str());
+	const CODEC codec = readfile && !snapshot ? detectCodec(formula.path.c_str()) : NOCODEC;
+	const bool cached = *opts.cache_path && !snapshot && lookupCache(readfile);
+	if (cached) {
+		// the model cannot be verified on a compressed input
+		if (codec != NOCODEC) formula.compressed = fsz;
+		PFLOG2(1, " Loading cached simplified formula of \"%s%s%s\" (size: %s%lld MB%s)",
+			CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
+	}
+	else if (snapshot)
+		PFLOG2(1, " Loading binary formula \"%s%s%s\" (size: %s%lld MB%s)",
+			CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
+	else if (codec != NOCODEC) {
+		if (!codecAvailable(codec)) PFLOGE("%s-compressed input is not supported by this build", codecName(codec));
+		formula.compressed = fsz;
+		PFLOG2(1, " Parsing %s-compressed CNF file \"%s%s%s\" (size: %s%lld MB%s)", codecName(codec),
+			CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
+	}
+	else if (readfile)
 		PFLOG2(1, " Parsing CNF file \"%s%s%s\" (size: %s%lld MB%s)",
 			CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
 	else {
@@ -47,9 +67,19 @@ bool Solver::parser()
 		formula.path.assign("stdin");
 		PFLOG2(1, " Reading DIMACS from \"%sstdin%s\" " EOF_MSG "...", CREPORTVAL, CNORMAL);
 	}
-	timer.start();
+	timer.wstart();
 	Lits_t in_c, org;
-	if (readfile) {
+	if (cached) {
+		struct stat cst;
+		if (!canAccess(cache.path().c_str(), cst)) PFLOGE("cannot access cache entry \"%s\"", cache.path().c_str());
+		if (!parseSnapshot(cache.path().c_str(), cst.st_size)) return false;
+	}
+	else if (snapshot) {
+		formula.snapshot = true;
+		if (!parseSnapshot(formula.path.c_str(), fsz)) return false;
+	}
+	else if (readfile && codec == NOCODEC) {
+		tokens.reset();
 		char* str = NULL;
 #if defined(__linux__) || defined(__CYGWIN__)
 		int fd = open(formula.path.c_str(), O_RDONLY, 0);
@@ -77,30 +107,14 @@ bool Solver::parser()
 			if (*str == '\0' || *str == '%') break;
 			if (*str == 'c') eatLine(str);
 			else if (*str == 'p') {
-				if (!eq(str, "p cnf")) PFLOGE("header has wrong format");
-				uint32 sign = 0;
-				inf.orgVars = toInteger(str, sign);
+				parseHeader(str);
 				if (!opts.parseincr_en) {
-					inf.unassigned = inf.maxVar = inf.orgVars;
-					inf.nDualVars = V2L(inf.orgVars + 1);
-				}
-				if (sign) PFLOGE("number of variables in header is negative");
-				if (inf.orgVars == 0) PFLOGE("zero number of variables in header");
-				if (inf.orgVars >= INT_MAX - 1) PFLOGE("number of variables not supported");
-				inf.nOrgCls = toInteger(str, sign);
-				if (sign) PFLOGE("number of clauses in header is negative");
-				if (inf.nOrgCls == 0) PFLOGE("zero number of clauses in header");
-				PFLOG2(1, " Found header %s%d %d%s", CREPORTVAL, inf.orgVars, inf.nOrgCls, CNORMAL);
-				assert(orgs.empty());
-				if (!opts.parseincr_en) {
-					allocSolver();
-					initQueue();
-					initHeap();
-					initVars();
-					assert(vorg.size() == inf.maxVar + 1);
-					model.init(vorg);
-					if (opts.proof_en)
-						proof.init(sp, vorg);
+					const uint64 rest = eof - str;
+					const int nthreads = (int)MIN(uint64(opts.parse_threads), rest / PARSE_MIN_CHUNK);
+					if (nthreads > 1) {
+						if (!parseChunks(in_c, org, str, eof, nthreads)) return false;
+						break;
+					}
 				}
 			}
 			else if (opts.parseincr_en) {
@@ -112,8 +126,9 @@ bool Solver::parser()
 				}
 				if (!itoClause(in_c, org)) return false;
 			}
-			else if (!toClause(in_c, org, str)) return false;
+			else if (!toClause(in_c, org, str, eof)) return false;
 		}
+		if (!inf.orgVars && !inf.maxVar) PFLOGE("missing p cnf header");
 #if defined(__linux__) || defined(__CYGWIN__)
 		if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean input file %s mapping", formula.path.c_str());
 		close(fd);
@@ -125,169 +140,152 @@ bool Solver::parser()
 	else {
 		in_c.reserve(INIT_CAP);
 		org.reserve(INIT_CAP);
-		int ch;
-		formula.eatComment(ch);
-		// read CNF header
-		if (ch != 'p')
-			PFLOGE("expected 'c' or 'p'");
-		ch = formula.get();
-		if (!isSpace(ch))
-			PFLOGE("expected space after 'p'");
-		else
-			formula.eatWS(ch);
-		if (ch == 'c') {
-			if ((ch = formula.get()) != 'n')
-				PFLOGE("expected 'n' after 'p c'");
-			if ((ch = formula.get()) != 'f')
-				PFLOGE("expected 'f' after 'p cn'");
-			ch = formula.get();
-			if (!isSpace(ch))
-				PFLOGE("expected space after 'p cnf'");
-			formula.eatWS(ch);
-			if (isSpace(ch)) PFLOGE("expected digit after 'p cnf '");
-			uint32 sign = 0;
-			inf.orgVars = formula.toInteger(ch, sign);
-			if (!opts.parseincr_en) {
-				inf.unassigned = inf.maxVar = inf.orgVars;
-				inf.nDualVars = V2L(inf.orgVars + 1);
-			}
-			if (sign) PFLOGE("number of variables in header is negative");
-			if (inf.orgVars == 0) PFLOGE("zero number of variables in header");
-			if (inf.orgVars >= INT_MAX - 1) PFLOGE("number of variables not supported");
-			if (!isSpace(ch))
-				PFLOGE("expected space after 'p cnf %d'", inf.orgVars);
-			formula.eatWS(ch);
-			if (!isDigit(ch))
-				PFLOGE("expected digit after 'p cnf %d '", inf.orgVars);
-			inf.nOrgCls = formula.toInteger(ch, sign);
-			if (sign) PFLOGE("number of clauses in header is negative");
-			if (inf.nOrgCls == 0) PFLOGE("zero number of clauses in header");
-			while (ch != '\n') {
-				if (!isSpace(ch))
-					PFLOGE("expected newline after 'p cnf %d %d'", inf.orgVars, inf.nOrgCls);
-				ch = formula.get();
-			}
-			PFLOG2(1, " Found header %s%d %d%s", CREPORTVAL, inf.orgVars, inf.nOrgCls, CNORMAL);
-			assert(orgs.empty());
-			if (!opts.parseincr_en) {
-				allocSolver();
-				initQueue();
-				initHeap();
-				initVars();
-				assert(vorg.size() == inf.maxVar + 1);
-				model.init(vorg);
-				if (opts.proof_en)
-					proof.init(sp, vorg);
-			}
+		if (codec != NOCODEC) {
+			DECODER source(formula.path, codec);
+			if (!parseStream(in_c, org, source)) return false;
+			// the decoder runs alongside the parser, so only the wall
+			// clock gives the rate at which compressed input is consumed
+			timer.wstop();
+			PFLOG2(2, "  decompressed %s%lld MB%s on a separate thread at %s%.2f MB/s%s of compressed input",
+				CREPORTVAL, ratio(formula.size, uint64(MBYTE)), CNORMAL,
+				CREPORTVAL, ratio(double(formula.compressed), double(MBYTE)) / MAX(timer.wallTime(), 1e-6f), CNORMAL);
 		}
-		else
-			PFLOGE("expected 'c' after 'p '");
-		// now read clauses
-		while ((ch = formula.get()) != EOF) {
-			if (isSpace(ch)) continue;
-			else if (opts.parseincr_en) {
-				incremental = true;
-				uint32 v = 0, s = 0;
-				while ((v = formula.toInteger(ch, s)) != 0) {
-					while (v > inf.maxVar) iadd();
-					org.push(V2DEC(v, s));
-				}
-				if (!itoClause(in_c, org)) return false;
-			}
-			else if (!toClause(in_c, org, ch)) return false;
+		else {
+			FDSOURCE source;
+			if (!parseStream(in_c, org, source)) return false;
 		}
 	}
 	assert(stats.clauses.original == orgs.size());
 	assert(orgs.size() <= inf.nOrgCls);
 	orgs.shrinkCap();
 	in_c.clear(true), org.clear(true);
-	timer.stop();
-	timer.parse = timer.cpuTime();
+	timer.wstop();
+	timer.parse = timer.wallTime();
 	PFLOG2(1, " Read %s%d Variables%s, %s%d Clauses%s, and %s%lld Literals%s in %s%.2f seconds%s",
 		CREPORTVAL, inf.maxVar, CNORMAL,
 		CREPORTVAL, orgs.size() + trail.size(), CNORMAL,
 		CREPORTVAL, stats.literals.original + trail.size(), CNORMAL,
 		CREPORTVAL, timer.parse, CNORMAL);
+	if (!cached && !snapshot && formula.size && timer.parse > 0)
+		PFLOG2(1, "  throughput %s%.2f MB/s%s%s", CREPORTVAL, ratio(double(formula.size), double(MBYTE)) / timer.parse, CNORMAL,
+			tokens.classify && readfile && codec == NOCODEC && !opts.parseincr_en ? " using a vectorized tokenizer" : "");
 	PFLOG2(1, "  found %s%d units%s, %s%d binaries%s, %s%d ternaries%s, %s%d larger%s", 
 		CREPORTVAL, formula.units, CNORMAL, 
 		CREPORTVAL, formula.binaries, CNORMAL, 
 		CREPORTVAL, formula.ternaries, CNORMAL, 
 		CREPORTVAL, formula.large, CNORMAL);
+	if (opts.dedup_en) {
+		dedup.destroy();
+		PFLOG2(1, "  removed %s%d duplicates%s (%s%d binaries%s)",
+			CREPORTVAL, formula.duplicates, CNORMAL,
+			CREPORTVAL, formula.dupbinaries, CNORMAL);
+	}
 	PFLOG2(1, "  maximum clause size: %s%d%s", CREPORTVAL, formula.maxClauseSize, CNORMAL);
+	if (*opts.snapshot_path) writeSnapshot(opts.snapshot_path, false);
 	return true;
 }
 
-bool Solver::toClause(Lits_t& c, Lits_t& org, char*& str)
+bool Solver::lookupCache(const bool& readfile)
 {
-	assert(c.empty());
-	assert(org.empty());
-	uint32 v = 0, s = 0;
-	bool satisfied = false;
-	while ((v = toInteger(str, s)) != 0) {
-		if (v > inf.maxVar) PFLOGE("too many variables");
-		uint32 lit = V2DEC(v, s);
-		CHECKLIT(lit);
-		org.push(lit);
-		// checking literal
-		LIT_ST marker = l2marker(lit);
-		if (UNASSIGNED(marker)) {
-			markLit(lit);
-			LIT_ST val = sp->value[lit];
-			if (UNASSIGNED(val)) c.push(lit);
-			else if (val) satisfied = true;
-		}
-		else if (marker != SIGN(lit)) satisfied = true; // tautology
-	}
-	forall_clause(org, k) {
-		unmarkLit(*k);
-	}
-	if (satisfied) {
-		if (opts.proof_en) proof.deleteClause(org);
+	assert(*opts.cache_path);
+	if (!readfile) { PFLOGW("simplified formulas of stdin cannot be cached"); return false; }
+	if (!opts.sigma_en || opts.parseincr_en) return false;
+	if (opts.proof_en) { PFLOGW("simplified formulas cannot be cached while writing a proof"); return false; }
+	if (!cache.init(opts.cache_path, uint64(opts.cache_size) * MBYTE)) {
+		PFLOGW("cannot use \"%s\" as a cache directory", opts.cache_path);
+		return false;
 	}
-	else {
-		int newsize = c.size();
-		if (!newsize) {
-			if (opts.proof_en) proof.addEmpty();
-			return false; 
-		}
-		else if (newsize == 1) {
-			const uint32 unit = *c;
-			CHECKLIT(unit);
-			LIT_ST val = sp->value[unit];
-			if (UNASSIGNED(val)) enqueueUnit(unit), formula.units++;
-			else if (!val) return false;
-		}
-		else if (orgs.size() + 1 > inf.nOrgCls) PFLOGE("too many clauses");
-		else if (newsize) {
-			if (newsize == 2) formula.binaries++;
-			else if (newsize == 3) formula.ternaries++;
-			else assert(newsize > 3), formula.large++;
-			if (newsize > formula.maxClauseSize)
-				formula.maxClauseSize = newsize;
-			newClause(c, false);
+	const bool hit = cache.lookup(cacheKey(formula.size), formula.size);
+	PFLOG2(2, "  cache %s on \"%s\"", hit ? "hit" : "miss", cache.path().c_str());
+	return hit;
+}
+
+void Solver::parseHeader(char*& str)
+{
+	if (!eq(str, "p cnf")) PFLOGE("header has wrong format");
+	uint32 sign = 0;
+	inf.orgVars = toInteger(str, sign);
+	if (sign) PFLOGE("number of variables in header is negative");
+	if (inf.orgVars == 0) PFLOGE("zero number of variables in header");
+	if (inf.orgVars >= INT_MAX - 1) PFLOGE("number of variables not supported");
+	inf.nOrgCls = toInteger(str, sign);
+	if (sign) PFLOGE("number of clauses in header is negative");
+	if (inf.nOrgCls == 0) PFLOGE("zero number of clauses in header");
+	PFLOG2(1, " Found header %s%d %d%s", CREPORTVAL, inf.orgVars, inf.nOrgCls, CNORMAL);
+	initFormula();
+	if (opts.dedup_en) dedup.reserve(headerClauses());
+}
+
+void Solver::initFormula()
+{
+	assert(orgs.empty());
+	if (!opts.parseincr_en) {
+		inf.unassigned = inf.maxVar = inf.orgVars;
+		inf.nDualVars = V2L(inf.orgVars + 1);
+		allocSolver();
+		initQueue();
+		initHeap();
+		initVars();
+		assert(vorg.size() == inf.maxVar + 1);
+		model.init(vorg);
+		if (opts.proof_en) {
+			proof.init(sp, vorg);
+			if (opts.lrat_en) proof.initLRAT(inf.orgVars, inf.nOrgCls);
 		}
-		if (opts.proof_en && newsize < org.size()) {
-			proof.addClause(c);
-			proof.deleteClause(org);
-			org.clear();
+	}
+}
+
+bool Solver::parseStream(Lits_t& c, Lits_t& org, DSOURCE& source)
+{
+	assert(c.empty());
+	assert(org.empty());
+	RESETSTRUCT(&inf);
+	// windows end after a newline, so tokens and comments are never
+	// split but a clause may continue in the next window
+	DSTREAM in(source);
+	char* str = NULL;
+	bool stopped = false;
+	while (!stopped && (str = in.next()) != NULL) {
+		char* end = in.end();
+		while (true) {
+			eatWS(str);
+			if (str == end) break;
+			if (*str == '\0' || *str == '%') { stopped = true; break; }
+			if (org.empty() && *str == 'c') eatLine(str);
+			else if (org.empty() && *str == 'p') parseHeader(str);
+			else if (!inf.orgVars) PFLOGE("expected 'c' or 'p'");
+			else {
+				uint32 s = 0;
+				const uint32 v = toInteger(str, s);
+				if (v) {
+					if (opts.parseincr_en) { while (v > inf.maxVar) iadd(); }
+					else if (v > inf.maxVar) PFLOGE("too many variables");
+					org.push(V2DEC(v, s));
+				}
+				else if (opts.parseincr_en) {
+					incremental = true;
+					if (!itoClause(c, org)) return false;
+				}
+				else if (!toClause(c, org)) return false;
+			}
 		}
 	}
-	c.clear(), org.clear();
+	if (!org.empty()) PFLOGE("unexpected EOF in clause");
+	// an empty or comment-only input never initializes the solver
+	if (!inf.orgVars && !inf.maxVar) PFLOGE("missing p cnf header");
+	formula.size = in.bytesRead();
 	return true;
 }
 
-bool Solver::toClause(Lits_t& c, Lits_t& org, int& ch)
+bool Solver::toClause(Lits_t& c, Lits_t& org)
 {
 	assert(c.empty());
-	assert(org.empty());
-	uint32 v = 0, s = 0;
+	if (opts.modelverifymem_en) model.saveOriginal(org);
+	const uint64 orgid = opts.lrat_en ? proof.original() : 0;
 	bool satisfied = false;
-	while ((v = formula.toInteger(ch, s)) != 0) {
-		formula.eatWS(ch);
-		if (v > inf.maxVar) PFLOGE("too many variables");
-		uint32 lit = V2DEC(v, s);
+	forall_clause(org, k) {
+		const uint32 lit = *k;
 		CHECKLIT(lit);
-		org.push(lit);
 		// checking literal
 		LIT_ST marker = l2marker(lit);
 		if (UNASSIGNED(marker)) {
@@ -302,12 +300,21 @@ bool Solver::toClause(Lits_t& c, Lits_t& org, int& ch)
 		unmarkLit(*k);
 	}
 	if (satisfied) {
-		if (opts.proof_en) proof.deleteClause(org);
+		if (opts.lrat_en) proof.deleteClause(orgid);
+		else if (opts.proof_en) proof.deleteClause(org);
 	}
 	else {
 		int newsize = c.size();
+		if (opts.lrat_en && (newsize < org.size() || newsize == 1)) {
+			// falsified literals are removed by their root units
+			forall_clause(org, k) {
+				if (!sp->value[*k]) proof.hintUnit(*k);
+			}
+			proof.hint(orgid);
+		}
 		if (!newsize) {
-			if (opts.proof_en) proof.addEmpty();
+			// in LRAT the pending hints are consumed by 'learnEmpty'
+			if (opts.proof_en && !opts.lrat_en) proof.addEmpty();
 			PFLOG2(1, "  Found empty clause");
 			return false;
 		}
@@ -316,18 +323,38 @@ bool Solver::toClause(Lits_t& c, Lits_t& org, int& ch)
 			CHECKLIT(unit);
 			LIT_ST val = sp->value[unit];
 			if (UNASSIGNED(val)) enqueueUnit(unit), formula.units++;
-			else if (!val) return false;
+			else if (!val) {
+				if (opts.lrat_en) proof.refuteUnit(unit);
+				return false;
+			}
 		}
 		else if (orgs.size() + 1 > inf.nOrgCls) PFLOGE("too many clauses");
 		else if (newsize) {
+			const uint64 key = opts.dedup_en ? clauseHash(c) : 0;
+			if (key && isDuplicate(c, key)) {
+				formula.duplicates++;
+				if (newsize == 2) formula.dupbinaries++;
+				if (opts.lrat_en) proof.clearHints(), proof.deleteClause(orgid);
+				else if (opts.proof_en) proof.deleteClause(org);
+				c.clear(), org.clear();
+				return true;
+			}
 			if (newsize == 2) formula.binaries++;
 			else if (newsize == 3) formula.ternaries++;
 			else assert(newsize > 3), formula.large++;
 			if (newsize > formula.maxClauseSize)
 				formula.maxClauseSize = newsize;
-			newClause(c, false);
+			const C_REF r = newClause(c, false);
+			if (key) dedup.insert(key, r);
+			if (opts.lrat_en) {
+				if (newsize < org.size()) {
+					proof.addClause(cm[r]);
+					proof.deleteClause(orgid);
+				}
+				else cm[r].set_lratid(orgid);
+			}
 		}
-		if (opts.proof_en && newsize < org.size()) {
+		if (opts.proof_en && !opts.lrat_en && newsize < org.size()) {
 			proof.addClause(c);
 			proof.deleteClause(org);
 			org.clear();
@@ -337,6 +364,73 @@ bool Solver::toClause(Lits_t& c, Lits_t& org, int& ch)
 	return true;
 }
 
+bool Solver::isDuplicate(const Lits_t& c, const uint64& key)
+{
+	bool found = false;
+	for (uint32 i = dedup.first(key); !found && !dedup.empty(i); i = dedup.next(i)) {
+		if (dedup.key(i) != key) continue;
+		CLAUSE& d = cm[dedup.ref(i)];
+		if (d.size() != c.size()) continue;
+		for (int k = 0; k < c.size(); k++) markLit(c[k]);
+		found = true;
+		forall_clause(d, k) {
+			if (l2marker(*k) != SIGN(*k)) { found = false; break; }
+		}
+		for (int k = 0; k < c.size(); k++) unmarkLit(c[k]);
+	}
+	return found;
+}
+
+bool Solver::toClause(Lits_t& c, Lits_t& org, char*& str, const char* eof)
+{
+	assert(org.empty());
+	readClause(str, eof, org, inf.maxVar, tokens);
+	return toClause(c, org);
+}
+
+bool Solver::parseChunks(Lits_t& c, Lits_t& org, char* str, char* eof, const int& nthreads)
+{
+	assert(nthreads > 1);
+	assert(str < eof);
+	PFLOG2(2, "  tokenizing clauses on %d threads..", nthreads);
+	// split at clause boundaries so every chunk holds whole clauses
+	DCHUNK* chunks = new DCHUNK[nthreads];
+	const uint64 step = uint64(eof - str) / nthreads;
+	char* begin = str;
+	for (int i = 0; i < nthreads; i++) {
+		DCHUNK& chunk = chunks[i];
+		chunk.begin = begin;
+		if (i == nthreads - 1) chunk.end = eof;
+		else {
+			char* split = str + step * (i + 1);
+			chunk.end = nextClause(split < begin ? begin : split, str, eof);
+		}
+		begin = chunk.end;
+	}
+	std::thread* workers = new std::thread[nthreads];
+	for (int i = 0; i < nthreads; i++)
+		workers[i] = std::thread(&DCHUNK::tokenize, chunks + i, inf.maxVar, tokens.classify);
+	// commit clauses in file order while later chunks are still tokenized
+	bool ok = true, stopped = false;
+	for (int i = 0; i < nthreads; i++) {
+		workers[i].join();
+		DCHUNK& chunk = chunks[i];
+		if (ok && !stopped) {
+			const uint32* lits = chunk.lits.data(), * end = chunk.lits.end();
+			while (lits != end) {
+				while (*lits) org.push(*lits++);
+				lits++;
+				if (!toClause(c, org)) { ok = false; break; }
+			}
+			stopped = chunk.stopped;
+		}
+		chunk.lits.clear(true);
+	}
+	delete[] workers;
+	delete[] chunks;
+	return ok;
+}
+
 #if defined(__GNUC__) && (__GNUC__ >= 8)
 #pragma GCC diagnostic pop
 #endif
\ No newline at end of file
@@ -21,11 +21,78 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "sort.h"
 #include "definitions.h"
+#include "simd.h"
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <cerrno>
 
 namespace ParaFROST {
 
+	// minimum slots of the duplicates table
+	constexpr uint32 DEDUP_MIN_CAP = (1U << 16);
+
+	// order-independent hash of the literals in 'c' (never zero)
+	inline uint64 clauseHash(const Lits_t& c)
+	{
+		uint64 hash = uint64(c.size()) * 0x9E3779B97F4A7C15ULL;
+		for (int i = 0; i < c.size(); i++) {
+			uint64 x = c[i];
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+			hash += x ^ (x >> 31);
+		}
+		return hash ? hash : 1;
+	}
+
+	/*****************************************************/
+	/*  Usage:   open-addressing table of parsed clauses */
+	/*           keyed by the hash of their literals     */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	class DEDUP {
+		struct SLOT { uint64 key; C_REF ref; }; // key 0 marks an empty slot
+		Vec<SLOT>	slots;
+		uint32		mask, count;
+
+		inline void place(const uint64& key, const C_REF& ref) {
+			uint32 i = uint32(key) & mask;
+			while (slots[i].key) i = (i + 1) & mask;
+			slots[i].key = key, slots[i].ref = ref;
+		}
+		inline void grow(const uint32& cap) {
+			assert(cap && !(cap & (cap - 1)));
+			Vec<SLOT> old;
+			slots.migrateTo(old);
+			slots.resize(cap);
+			std::memset(slots.data(), 0, sizeof(SLOT) * cap);
+			mask = cap - 1;
+			for (uint32 i = 0; i < old.size(); i++) {
+				if (old[i].key) place(old[i].key, old[i].ref);
+			}
+		}
+	public:
+		DEDUP() : mask(0), count(0) {}
+		// sized for 'clauses' entries at half load
+		inline void		reserve	(const uint32& clauses) {
+			uint32 cap = DEDUP_MIN_CAP;
+			while (cap < (uint64(clauses) << 1) && cap < (1U << 31)) cap <<= 1;
+			if (cap > slots.size()) grow(cap);
+		}
+		// first slot to probe for 'key'; walk with 'next' until 'empty'
+		inline uint32	first	(const uint64& key) const { return slots.empty() ? 0 : uint32(key) & mask; }
+		inline uint32	next	(const uint32& i) const { return (i + 1) & mask; }
+		inline bool		empty	(const uint32& i) const { return slots.empty() || !slots[i].key; }
+		inline uint64	key		(const uint32& i) const { return slots[i].key; }
+		inline C_REF	ref		(const uint32& i) const { return slots[i].ref; }
+		inline void		insert	(const uint64& key, const C_REF& ref) {
+			assert(key);
+			if (((count + 1) << 1) > slots.size()) grow(slots.empty() ? DEDUP_MIN_CAP : (slots.size() << 1));
+			place(key, ref);
+			count++;
+		}
+		inline void		destroy	() { slots.clear(true), mask = count = 0; }
+	};
+
 	template <class T>
 	inline bool isDigit(const T& ch) { return (ch ^ 48) <= 9; }
 
@@ -35,61 +102,39 @@ namespace ParaFROST {
 	struct FORMULA {
 		string path;
 		double c2v;
-		uint64 size;
+		uint64 size, compressed;
 		uint32 units, large, binaries, ternaries;
+		uint32 duplicates, dupbinaries;
 		int maxClauseSize;
+		bool snapshot, simplified;
 		FORMULA() : 
 			path()
 			, c2v(0)
 			, size(0)
+			, compressed(0)
 			, units(0)
 			, large(0)
 			, binaries(0)
 			, ternaries(0)
-			, maxClauseSize(0) {}
+			, duplicates(0)
+			, dupbinaries(0)
+			, maxClauseSize(0)
+			, snapshot(false)
+			, simplified(false) {}
 		FORMULA(const string& path) :
 			path(path)
 			, c2v(0)
 			, size(0)
+			, compressed(0)
 			, units(0)
 			, large(0)
 			, binaries(0)
 			, ternaries(0)
-			, maxClauseSize(0) {}
-
-		inline int get() { size++; return std::cin.get(); }
-
-		inline void eatWS(int& ch) { while (isSpace((ch = get()))); }
-
-		inline void eatComment(int& ch) {
-			while (true) {
-				ch = get();
-				if (isSpace(ch)) continue;
-				if (ch != 'c') break;
-				while ((ch = get()) != '\n')
-					if (ch == EOF)
-						PFLOGE("unexpected EOF in comment");
-			}
-		}
-
-		inline uint32 toInteger(int& ch, uint32& sign)
-		{
-			sign = 0;
-			if (ch == '-') {
-				sign = 1;
-				ch = get();
-			}
-			else if (ch == '+')
-				ch = get();
-			if (!isDigit(ch))
-				PFLOGE("expected a digit but ASCII(%d) is found", ch);
-			uint32 n = 0;
-			while (isDigit(ch)) {
-				n = n * 10 + (ch - 48);
-				ch = get();
-			}
-			return n;
-		}
+			, duplicates(0)
+			, dupbinaries(0)
+			, maxClauseSize(0)
+			, snapshot(false)
+			, simplified(false) {}
 	};
 
 	inline bool isDigit(const char& ch) { return (ch ^ '0') <= 9; }
@@ -110,6 +155,274 @@ namespace ParaFROST {
 		return n;
 	}
 
+	/*****************************************************/
+	/*  Usage:   digit, space and sign masks of the      */
+	/*           input block at the reading position     */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	struct TOKENIZER {
+		CLASSIFIER classify;
+		const char* block; // input address of the classified block
+		const char* data; // bytes of 'block', either the input itself or 'tail'
+		uint64 digits, spaces, signs, starts; // 'starts' marks the digit runs not read yet
+		char before; // the byte before 'block' if it was classified, otherwise 0
+		char tail[TOKEN_BLOCK + 8]; // zero-padded copy of the last input bytes
+		TOKENIZER(CLASSIFIER classify = NULL) : 
+			classify(classify)
+			, block(NULL)
+			, data(NULL)
+			, digits(0)
+			, spaces(0)
+			, signs(0)
+			, starts(0)
+			, before(0) {}
+		inline void reset() { block = data = NULL, starts = 0, before = 0; }
+		inline bool holds(const char* p) const { return block != NULL && p >= block && p < block + TOKEN_BLOCK; }
+		// classifies the block at 'p'; the last bytes before 'eof' are copied to 'tail'
+		// so that neither the classifier nor an 8-byte digit load reads past 'eof';
+		// 'carry' is set if the byte before 'p' is a digit continuing into the block
+		inline void load(const char* p, const char* eof, const uint64& carry = 0) {
+			assert(classify != NULL);
+			assert(p <= eof);
+			block = p;
+			if (eof - p >= TOKEN_BLOCK + 8) data = p;
+			else {
+				const size_t n = MIN(size_t(eof - p), size_t(TOKEN_BLOCK));
+				std::memcpy(tail, p, n);
+				std::memset(tail + n, 0, sizeof(tail) - n);
+				data = tail;
+			}
+			classify(data, digits, spaces, signs);
+			starts = digits & ~((digits << 1) | carry);
+		}
+		// reports the byte at 'i' as 'toInteger' would, that is, the
+		// byte after it for a sign not followed by a digit
+		inline void error(const int& i) const {
+			assert(i < TOKEN_BLOCK);
+			const int at = i >= 0 && !((signs >> i) & 1) ? i : i + 1;
+			PFLOGE("expected a digit but ASCII(%d) is found", data[at]);
+		}
+		// moves to the block after the current one
+		inline void next(const char* eof) {
+			const char last = data[TOKEN_BLOCK - 1];
+			load(block + TOKEN_BLOCK, eof, digits >> 63);
+			before = last;
+		}
+	};
+
+	// reads the literals of one clause up to its terminating 0 into 'org';
+	// with a classifier, the input is classified once in 'TOKEN_BLOCK' bytes
+	// whose masks stay in 'tokens' across clauses, literals are found by
+	// scanning the digit runs in 'starts' and converted with 'swarDigits',
+	// and only the bytes between them are checked to be spaces or a sign
+	template <class LITS>
+	inline void readClause(char*& str, const char* eof, LITS& org, const uint32& maxVar, TOKENIZER& tokens)
+	{
+		if (tokens.classify == NULL) {
+			uint32 v = 0, s = 0;
+			while ((v = toInteger(str, s)) != 0) {
+				if (v > maxVar) PFLOGE("too many variables");
+				org.push(V2DEC(v, s));
+			}
+			return;
+		}
+		if (!tokens.holds(str)) tokens.load(str, eof), tokens.before = 0;
+		int i = int(str - tokens.block);
+		tokens.starts &= ~0ULL << i;
+		while (true) {
+			assert(i < TOKEN_BLOCK);
+			while (!tokens.starts) {
+				// the block may only end with spaces and a sign of the next literal
+				const uint64 bad = ~(tokens.spaces | (tokens.signs & (1ULL << 63))) & (~0ULL << i);
+				if (bad) tokens.error(__builtin_ctzll(bad));
+				const bool sign = tokens.signs >> 63;
+				tokens.next(eof), i = 0;
+				if (sign && !(tokens.digits & 1)) tokens.error(-1);
+			}
+			const int p = __builtin_ctzll(tokens.starts);
+			tokens.starts &= tokens.starts - 1;
+			// spaces up to the literal except a sign just before it
+			const uint64 gap = (~0ULL << i) & ((1ULL << p) - 1);
+			const uint64 bad = gap & ~(tokens.spaces | (tokens.signs & ((1ULL << p) >> 1)));
+			if (bad) tokens.error(__builtin_ctzll(bad));
+			const uint32 sign = (p ? tokens.data[p - 1] : tokens.before) == '-';
+			// the complement has ones above the block, so 'len' stops at its end
+			const uint64 run = ~(tokens.digits >> p);
+			int len = run ? __builtin_ctzll(run) : TOKEN_BLOCK;
+			uint64 n = 0;
+			if (p + len < TOKEN_BLOCK && len <= 16) {
+				if (len <= 8) n = swarDigits(tokens.data + p, len);
+				else n = uint64(swarDigits(tokens.data + p, len - 8)) * 100000000ULL + swarDigits(tokens.data + p + len - 8, 8);
+				i = p + len;
+			}
+			else { // runs continuing in the next blocks or with leading zeros
+				const char* digits = tokens.block + p;
+				if (p + len < TOKEN_BLOCK) i = p + len;
+				else {
+					tokens.next(eof);
+					while (!~tokens.digits) len += TOKEN_BLOCK, tokens.next(eof);
+					i = __builtin_ctzll(~tokens.digits);
+					len += i;
+				}
+				for (int k = 0; k < len; k++)
+					if ((n = n * 10 + (digits[k] - '0')) > maxVar) PFLOGE("too many variables");
+			}
+			if (!n) { str = (char*)tokens.block + i; return; }
+			if (n > maxVar) PFLOGE("too many variables");
+			org.push(V2DEC(uint32(n), sign));
+		}
+	}
+
+	// smallest part of the input given to a parsing thread
+	constexpr uint64 PARSE_MIN_CHUNK = (4ULL << 20);
+
+	// returns the first clause boundary at or after 'p', that is, the position
+	// just after a terminating '0', or the position of a '%' or '\0' which
+	// ends the formula; comment lines are skipped and 'p' is first moved to
+	// the start of a line so it is never in the middle of a token or comment
+	inline char* nextClause(char* p, const char* begin, const char* eof)
+	{
+		if (p > begin && p[-1] != '\n')
+			while (p < eof && *p != '\n') p++;
+		while (p < eof) {
+			if (isSpace(*p)) { p++; continue; }
+			if (*p == 'c') { while (p < eof && *p != '\n') p++; continue; }
+			if (*p == '%' || *p == '\0') return p;
+			const char* token = p;
+			while (p < eof && !isSpace(*p)) p++;
+			if (p - token == 1 && *token == '0') return p;
+		}
+		return p;
+	}
+
+	/*****************************************************/
+	/*  Usage:   part of a mapped DIMACS file tokenized  */
+	/*           by one thread into zero-separated lits  */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	struct DCHUNK {
+		char* begin, * end;
+		Vec<uint32, size_t> lits;
+		bool stopped;
+		DCHUNK() : begin(NULL), end(NULL), stopped(false) {}
+
+		void tokenize(const uint32& maxVar, CLASSIFIER classify) {
+			TOKENIZER tokens(classify);
+			char* str = begin;
+			lits.reserve((end - begin) >> 3);
+			while (str < end) {
+				eatWS(str);
+				if (str >= end) break;
+				if (*str == '\0' || *str == '%') { stopped = true; break; }
+				if (*str == 'c') { eatLine(str); continue; }
+				if (*str == 'p') PFLOGE("unexpected header after clauses");
+				readClause(str, end, lits, maxVar, tokens);
+				lits.push(0);
+			}
+		}
+	};
+
+	// initial size of the buffer streaming a non-seekable input
+	constexpr uint64 STREAM_BLOCK = (1ULL << 20);
+
+	/*****************************************************/
+	/*  Usage:   source of raw DIMACS bytes              */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	class DSOURCE {
+	public:
+		virtual ~DSOURCE() {}
+		// returns the number of bytes copied to 'buffer' (0 at EOF)
+		virtual int64 read(char* buffer, const size_t& n) = 0;
+	};
+
+	class FDSOURCE : public DSOURCE {
+		int fd;
+	public:
+		FDSOURCE(const int& fd = 0) : fd(fd) {}
+		int64 read(char* buffer, const size_t& n) {
+			while (true) {
+				const int64 bytes = ::read(fd, buffer, n);
+				if (bytes >= 0) return bytes;
+				if (errno != EINTR) PFLOGE("cannot read input stream");
+			}
+		}
+	};
+
+	/*****************************************************/
+	/*  Usage:   block-wise reader of a DIMACS stream    */
+	/*           handing out windows of complete lines   */
+	/*  Dependency:  DSOURCE                             */
+	/*****************************************************/
+	class DSTREAM {
+		char* buffer;
+		uint64 cap, size, window, bytes;
+		DSOURCE& source;
+		char saved;
+		bool eof;
+
+		inline void grow() {
+			cap <<= 1;
+			pfralloc(buffer, cap);
+		}
+		// fill the buffer up to its capacity (minus the sentinel) or until EOF
+		inline void fill() {
+			while (!eof && size + 1 < cap) {
+				const int64 n = source.read(buffer + size, cap - size - 1);
+				if (!n) eof = true;
+				size += n, bytes += n;
+			}
+		}
+	public:
+		DSTREAM(DSOURCE& source) :
+			buffer(NULL)
+			, cap(STREAM_BLOCK)
+			, size(0)
+			, window(0)
+			, bytes(0)
+			, source(source)
+			, saved(0)
+			, eof(false)
+		{
+			pfralloc(buffer, cap);
+		}
+		~DSTREAM() { if (buffer != NULL) std::free(buffer), buffer = NULL; }
+
+		inline uint64 bytesRead() const { return bytes; }
+		inline char* end() { return buffer + window; }
+
+		// returns the next window of complete lines terminated by '\0'
+		// (the last window may end without a newline), or NULL when drained
+		inline char* next() {
+			if (window) {
+				// move the unfinished line to the front
+				buffer[window] = saved;
+				size -= window;
+				if (size) std::memmove(buffer, buffer + window, size);
+				window = 0;
+			}
+			uint64 scanned = 0;
+			while (true) {
+				fill();
+				uint64 i = size;
+				while (i > scanned && buffer[i - 1] != '\n') i--;
+				if (i > scanned) { window = i; break; }
+				if (eof) {
+					if (!size) return NULL;
+					window = size;
+					break;
+				}
+				// a line longer than the buffer
+				scanned = size;
+				grow();
+			}
+			assert(window <= size && size < cap);
+			saved = buffer[window];
+			buffer[window] = '\0';
+			return buffer;
+		}
+	};
+
 	inline bool canAccess(const char* path, struct stat& st)
 	{
 		if (stat(path, &st)) return false;
@@ -76,14 +76,20 @@ bool Solver::prop()
 			if (propClause(values, f_assign, c))
 				c.markDeleted(); // clause satisfied by an assigned unit
 			else {
+				if (opts.lrat_en) proof.hintUnit(f_assign), proof.hint(c.lratid());
 				const int size = c.size();
 				if (!size) { learnEmpty(); return false; }
 				if (size == 1) {
 					const uint32 unit = *c;
 					CHECKLIT(unit);
 					if (UNASSIGNED(values[unit])) enqueueUnit(unit);
-					else { learnEmpty(); return false; }
+					else { 
+						if (opts.lrat_en) proof.refuteUnit(unit);
+						learnEmpty(); 
+						return false; 
+					}
 				}
+				else if (opts.lrat_en) proof.renewClause(c);
 			}
 		}
 		ot[f_assign].clear(true);
@@ -220,13 +226,16 @@ void Solver::strengthen(SCLAUSE& c, const uint32& me)
 		}
 		else if (!val) { 
 			PFLOG2(2, "  SUB proved a contradiction");
+			if (opts.lrat_en) proof.refuteUnit(unit);
 			learnEmpty();
 			killSolver();
 		}
 	}
 	else {
 		assert(c.isSorted());
-		if (opts.proof_en) 
+		if (opts.lrat_en)
+			proof.renewClause(c);
+		else if (opts.proof_en) 
 			proof.addResolvent(c);
 		if (c.learnt()) 
 			bumpShrunken(c);
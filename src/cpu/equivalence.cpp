@@ -23,13 +23,11 @@ using namespace ParaFROST;
 // but start with learnts first which gives priority to substituted learnts in 
 // the watch table when new clauses are added
 
-inline uint32 Solver::minReachable(WL& ws, DFS* dfs, const DFS& node) 
+inline uint32 Solver::minReachable(BL& bs, DFS* dfs, const DFS& node) 
 {
 	uint32 new_min = node.min;
-	forall_watches(ws, i) {
-		const WATCH w = *i;
-		if (!w.binary()) continue;
-		const uint32 child = w.imp;
+	forall_bwatches(bs, i) {
+		const uint32 child = i->imp;
 		CHECKLIT(child);
 		if (inactive(child)) continue;
 		const DFS& child_dfs = dfs[child];
@@ -70,10 +68,10 @@ bool Solver::decompose()
 			}
 			else { // traverse all binaries 
 				assert(!smallests[parent]);
-				WL& ws = wt[parent]; // 'ws' holds the negations of 'parent'
+				BL& bs = bt[parent]; // 'bs' holds the negations of 'parent'
 				if (parent_dfs.idx) { // all children of parent visited and min reachable found
 					litstack.pop(); 
-					uint32 new_min = minReachable(ws, dfs, parent_dfs); // find min. reachable from the children of 'parent'
+					uint32 new_min = minReachable(bs, dfs, parent_dfs); // find min. reachable from the children of 'parent'
 					PFLOG2(4, " dfs search of parent(%d) with index %d reached minimum %d", l2i(parent), parent_dfs.idx, new_min);
 					if (parent_dfs.idx == new_min) { // start of SCC block
 						// find the smallest variable to represent this SCC 
@@ -127,10 +125,8 @@ bool Solver::decompose()
 					parent_dfs.idx = parent_dfs.min = dfs_idx;
 					scc.push(parent);
 					PFLOG2(4, " traversing all implications of parent(%d) at index %u", l2i(parent), dfs_idx);
-					forall_watches(ws, i) {
-						const WATCH w = *i;
-						if (!w.binary()) continue;
-						const uint32 child = w.imp;
+					forall_bwatches(bs, i) {
+						const uint32 child = i->imp;
 						CHECKLIT(child);
 						if (inactive(child)) continue;
 						const DFS& child_dfs = dfs[child];
@@ -256,7 +252,7 @@ bool Solver::substitute(BCNF& cnf, uint32* smallests)
 			deleted++;
 			uint32 last = cnf.size();
 			removeClause(c, ref);
-			sp->learntLBD = c.lbd();
+			if (c.learnt()) sp->learntLBD = meta(c).lbd();
 			C_REF newref = newClause(learntC, c.learnt());
 			PFLCLAUSE(4, cm[newref], "  learnt after substitution");
 			assert(cnf[last] == newref);
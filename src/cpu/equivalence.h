@@ -49,21 +49,37 @@ inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 	const uint32 n = NEG(p), def_f = FLIP(def);
 	OL& poss = ot[p], & negs = ot[n];
 	const bool proofEN = solver->opts.proof_en;
+	const bool lratEN = solver->opts.lrat_en;
+	PROOF& proof = solver->proof;
+	// LRAT ids of the gate binaries (p -def) and (-p def)
+	uint64 posbin = 0, negbin = 0;
+	if (lratEN) {
+		forall_occurs(poss, i) { if ((*i)->molten()) posbin = (*i)->lratid(); }
+		forall_occurs(negs, i) { if ((*i)->molten()) negbin = (*i)->lratid(); }
+		assert(posbin && negbin);
+	}
 	// substitute negatives 
 	for (int i = 0; i < negs.size(); i++) {
 		SCLAUSE& neg = *negs[i];
 		if (neg.learnt() || neg.molten() || neg.has(def))
 			neg.markDeleted();
 		else if (neg.original()) {
+			if (lratEN) proof.hint(posbin), proof.hint(neg.lratid());
 			uint32 unit = substitute_single(n, neg, def_f);
 			if (unit) {
 				const LIT_ST val = solver->litvalue(unit);
 				if (UNASSIGNED(val))
 					solver->enqueueUnit(unit);
-				else if (!val) return true;
+				else if (!val) {
+					if (lratEN) proof.refuteUnit(unit);
+					return true;
+				}
+				else if (lratEN) proof.clearHints();
 			}
+			else if (lratEN)
+				proof.renewClause(neg);
 			else if (proofEN)
-				solver->proof.addResolvent(neg);
+				proof.addResolvent(neg);
 		}
 	}
 	// substitute positives
@@ -72,15 +88,22 @@ inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 		if (pos.learnt() || pos.molten() || pos.has(def_f))
 			pos.markDeleted();
 		else if (pos.original()) {
+			if (lratEN) proof.hint(negbin), proof.hint(pos.lratid());
 			uint32 unit = substitute_single(p, pos, def);
 			if (unit) {
 				const LIT_ST val = solver->litvalue(unit);
 				if (UNASSIGNED(val))
 					solver->enqueueUnit(unit);
-				else if (!val) return true;
+				else if (!val) {
+					if (lratEN) proof.refuteUnit(unit);
+					return true;
+				}
+				else if (lratEN) proof.clearHints();
 			}
+			else if (lratEN)
+				proof.renewClause(pos);
 			else if (proofEN)
-				solver->proof.addResolvent(pos);
+				proof.addResolvent(pos);
 		}
 	}
 	return false; 
@@ -66,14 +66,12 @@ void Solver::histCNF(BCNF& cnf, const bool& reset)
 
 	OCCUR* occs = occurs.data();
 
-	const bool* deleted = cm.stencil.data();
-
 	if (reset) 
 		memset(occs, 0, occurs.size() * sizeof(OCCUR));
 
 	forall_cnf(cnf, i) {
 		const C_REF ref = *i;
-		if (deleted[ref]) continue;
+		if (cm.deleted(ref)) continue;
 		CLAUSE& c = cm[ref];
 		count_occurs(c, occs);
 	}
@@ -31,10 +31,11 @@ inline S_REF fast_equality_check(OT& ot, uint32 x, uint32 y, uint32 z)
 	assert(x <= y && y <= z && x <= z);
 	forall_occurs(list, i) {
 		SCLAUSE& c = **i;
-		if (c.molten()) continue;
 		assert(c.isSorted());
+		// a match holds the gate literal, so only then
+		// is the clause ours to test for being molten
 		if (c.original() && c.size() == 3 &&
-			c[0] == x && c[1] == y && c[2] == z) return *i;
+			c[0] == x && c[1] == y && c[2] == z && !c.molten()) return *i;
 	}
 	return NULL;
 }
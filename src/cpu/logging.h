@@ -152,6 +152,12 @@ inline void REPCH(const char& ch, const size_t& size, const size_t& off = 0) {
         PRINT("(%.2f KB saved) ", diff / KBYTE); \
     }
 
+#define PFLGCSIZE(VERBOSITY, oldSize, newB) \
+    if (verbose >= VERBOSITY) { \
+        double diff = double(oldSize - newB.size()) * newB.bucket(); \
+        PRINT("(%.2f KB saved) ", diff / KBYTE); \
+    }
+
 #define PFLREDALL(SOLVER, VERBOSITY, MESSAGE) \
     if (verbose >= VERBOSITY) { \
         SOLVER->evalReds(); \
@@ -0,0 +1,102 @@
+/***********************************************************************[lrat.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solver.h"
+using namespace ParaFROST;
+
+// Collects the LRAT hints deriving the clause 'lits' from the
+// conflicting (or unit) clause 'ref' by walking the reasons of
+// the implied literals in post-order, such that every antecedent
+// is hinted before the clause it propagates. Literals of 'lits'
+// (except 'skip') and those removed by binary minimization are
+// assumed false by the checker and never expanded
+void Solver::hintChain(const C_REF& ref, const uint32* lits, const int& size, const uint32& skip)
+{
+	assert(opts.lrat_en);
+	assert(REASON(ref));
+	assert(hintstack.empty());
+	const clock_t start = clock();
+	const uint64 entered = ++stats.marker, done = ++stats.marker;
+	uint64* board = sp->board;
+	LEVELS levels = sp->level;
+	for (int i = 0; i < size; i++) {
+		const uint32 lit = lits[i];
+		CHECKLIT(lit);
+		if (lit == skip) continue;
+		const uint32 v = ABS(lit);
+		if (unassigned(lit) || levels[v]) board[v] = done;
+	}
+	forall_vector(uint32, minimized, v) {
+		board[*v] = done;
+	}
+	CLAUSE& c = cm[ref];
+	forall_clause(c, k) {
+		hintstack.push(*k);
+	}
+	while (hintstack.size()) {
+		const uint32 lit = hintstack.back();
+		CHECKLIT(lit);
+		const uint32 v = ABS(lit);
+		const uint64 state = board[v];
+		if (state == done) { hintstack.pop(); continue; }
+		if (state == entered) {
+			hintstack.pop();
+			board[v] = done;
+			proof.hint(cm[sp->source[v]].lratid());
+			continue;
+		}
+		assert(isFalse(lit));
+		if (!levels[v]) {
+			hintstack.pop();
+			board[v] = done;
+			proof.hintUnit(lit);
+			continue;
+		}
+		const C_REF r = sp->source[v];
+		assert(REASON(r));
+		board[v] = entered;
+		const uint32 flit = FLIP(lit);
+		CLAUSE& reason = cm[r];
+		forall_clause(reason, k) {
+			const uint32 other = *k;
+			if (NEQUAL(other, flit) && board[ABS(other)] != done)
+				hintstack.push(other);
+		}
+	}
+	proof.hint(c.lratid());
+	timer.lrat += (float(clock() - start) / CLOCKS_PER_SEC) * float(1000.0);
+}
+
+// Learns the negation of the failed literal 'lit' with
+// hints by propagating it again on top of the new units
+void Solver::learnFailed(const uint32& lit)
+{
+	CHECKLIT(lit);
+	assert(opts.lrat_en);
+	assert(!DL());
+	if (BCP()) { learnEmpty(); return; }
+	if (!unassigned(lit)) return;
+	const uint32 unit = FLIP(lit);
+	enqueueDecision(lit);
+	ignore = NOREF;
+	const bool failed = BCPVivify();
+	if (failed) hintChain(conflict, &unit, 1);
+	backtrack();
+	conflict = NOREF;
+	if (failed) enqueueUnit(unit);
+}
@@ -50,18 +50,21 @@ inline bool	Solver::verifySeen()
 	return true;
 }
 
-inline bool Solver::valid(const LIT_ST* values, WL& ws)
+inline bool Solver::valid(const LIT_ST* values, BL& bs, WL& ws)
 {
+	forall_bwatches(bs, i) {
+		const BWATCH w = *i;
+		// if 'w.imp' not satisfied then it's an implication of 'cand'
+		if (values[w.imp] <= 0 && !cm.deleted(w.ref()))
+			return false;
+	}
 	forall_watches(ws, i) {
 		const WATCH w = *i;
 		// clause satisfied
 		if (values[w.imp] > 0) continue;
-		// if 'w.imp' not satisfied then it's an implication of 'cand'
-		if (w.binary())
-			return false;
 		// there cannot be falsified literal as watched,
 		// so validating starts from 'c + 2'
-		CLAUSE& c = cm[w.ref];
+		CLAUSE& c = cm[w.ref()];
 		assert(c.size() > 2);
 		bool satisfied = false, unAssigned = false;
 		uint32* k = c + 2, * cend = c.end();
@@ -78,12 +81,23 @@ inline bool Solver::valid(const LIT_ST* values, WL& ws)
 	return true;
 }
 
-inline bool Solver::depFreeze(const uint32& cand, const LIT_ST* values, LIT_ST* frozen, uint32*& stack, WL& ws)
+inline bool Solver::depFreeze(const uint32& cand, const LIT_ST* values, LIT_ST* frozen, uint32*& stack, BL& bs, WL& ws)
 {
+	forall_bwatches(bs, i) {
+		const BWATCH w = *i;
+		if (values[w.imp] > 0 || cm.deleted(w.ref())) continue;
+		const uint32 othervar = ABS(w.imp);
+		if (sp->seen[othervar]) return false;
+		if (!frozen[othervar]) {
+			frozen[othervar] = 1;
+			assert(stack < sp->tmpstack + inf.maxVar);
+			*stack++ = othervar;
+		}
+	}
 	forall_watches(ws, i) {
 		const WATCH w = *i;
 		if (values[w.imp] > 0) continue;
-		CLAUSE& c = cm[w.ref];
+		CLAUSE& c = cm[w.ref()];
 		uint32* lits = c.data();
 		uint32 othervar = ABS(lits[0]) ^ ABS(lits[1]) ^ cand;
 		if (sp->seen[othervar]) return false;
@@ -118,7 +132,7 @@ inline void Solver::MDMAssume(const LIT_ST* values, LIT_ST* frozen, uint32*& tai
 		const LIT_ST val = values[a];
 		if (UNASSIGNED(val)) {
 			level++;
-			if (!depFreeze(cand, values, frozen, tail, wt[a]))
+			if (!depFreeze(cand, values, frozen, tail, bt[a], wt[a]))
 				skip = true;
 			enqueueDecision(a);
 			sp->seen[cand] = 1;
@@ -25,15 +25,16 @@ namespace ParaFROST {
 
 	#define mdm_prefetch(VALUES,STATES,FROZEN,TAIL) \
 		const LIT_ST* VALUES = sp->value;				\
-		const VSTATE* STATES = sp->vstate;				\
+		CVSTATES STATES = sp->vstate;				\
 		LIT_ST* FROZEN = sp->frozen;					\
 		sp->stacktail = sp->tmpstack;					\
 		uint32*& TAIL = sp->stacktail;					\
 
 	#define mdm_assign(CAND,DEC) \
 		assert(CAND == ABS(DEC)); \
+		BL& bs = bt[DEC]; \
 		WL& ws = wt[DEC]; \
-		if (valid(values, ws) && depFreeze(CAND, values, frozen, tail, ws)) { \
+		if (valid(values, bs, ws) && depFreeze(CAND, values, frozen, tail, bs, ws)) { \
 			enqueueDecision(DEC); \
 			sp->seen[CAND] = 1; \
 		} \
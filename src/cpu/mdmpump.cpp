@@ -23,20 +23,23 @@ using namespace ParaFROST;
 inline void Solver::pumpFrozenHeap(const uint32& lit)
 {
 	CHECKLIT(lit);
+	BL& bs = bt[lit];
 	WL& ws = wt[lit];
-	if (ws.empty()) return;
+	if (bs.empty() && ws.empty()) return;
 	uint32 v = ABS(lit);
 	assert(!sp->frozen[v]);
 	double norm_act = (double)sp->level[v] / last.mdm.decisions;
+	forall_bwatches(bs, w) {
+		if (cm.deleted(w->ref())) continue;
+		const uint32 frozen_v = ABS(w->imp);
+		CHECKVAR(frozen_v);
+		if (activity[frozen_v] == 0) varBumpHeap(frozen_v, norm_act);
+	}
 	forall_watches(ws, w) {
-		if (cm.deleted(w->ref)) continue;
-		uint32 frozen_v;
-		if (w->binary()) frozen_v = ABS(w->imp);
-		else {
-			CLAUSE& c = cm[w->ref];
-			frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
-			assert(frozen_v != v);
-		}
+		if (cm.deleted(w->ref())) continue;
+		CLAUSE& c = cm[w->ref()];
+		const uint32 frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
+		assert(frozen_v != v);
 		CHECKVAR(frozen_v);
 		if (activity[frozen_v] == 0) varBumpHeap(frozen_v, norm_act);
 	}
@@ -45,19 +48,25 @@ inline void Solver::pumpFrozenHeap(const uint32& lit)
 inline void Solver::pumpFrozenQue(const uint32& lit)
 {
 	CHECKLIT(lit);
+	BL& bs = bt[lit];
 	WL& ws = wt[lit];
-	if (ws.empty()) return;
+	if (bs.empty() && ws.empty()) return;
 	uint32 v = ABS(lit);
 	assert(!sp->frozen[v]);
-	forall_watches(ws, w) {
-		if (cm.deleted(w->ref)) continue;
-		uint32 frozen_v;
-		if (w->binary()) frozen_v = ABS(w->imp);
-		else {
-			CLAUSE& c = cm[w->ref];
-			frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
-			assert(frozen_v != v);
+	forall_bwatches(bs, w) {
+		if (cm.deleted(w->ref())) continue;
+		const uint32 frozen_v = ABS(w->imp);
+		CHECKVAR(frozen_v);
+		if (sp->frozen[frozen_v]) {
+			analyzed.push(frozen_v);
+			sp->frozen[frozen_v] = 0;
 		}
+	}
+	forall_watches(ws, w) {
+		if (cm.deleted(w->ref())) continue;
+		CLAUSE& c = cm[w->ref()];
+		const uint32 frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
+		assert(frozen_v != v);
 		CHECKVAR(frozen_v);
 		if (sp->frozen[frozen_v]) {
 			analyzed.push(frozen_v);
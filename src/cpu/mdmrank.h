@@ -52,7 +52,7 @@ namespace SeqFROST {
 		occurs.resize(inf.maxVar + 1); \
 		histCNF(orgs, true); \
 		histCNF(learnts); \
-		const VSTATE* states = sp->vstate; \
+		CVSTATES states = sp->vstate; \
 		const LIT_ST* values = sp->value; \
 		OCCUR* occs = occurs.data(); \
 		uint32* scores = sp->tmpstack; \
@@ -79,7 +79,7 @@ namespace SeqFROST {
 		PFLOGN2(2, "  finding " #QUEUETYPE " eligible decisions.."); \
 		stats.mdm.QUEUETYPE++; \
 		eligible.clear(); \
-		const VSTATE* states = sp->vstate; \
+		CVSTATES states = sp->vstate; \
 		const LIT_ST* values = sp->value; \
 		uint32 freevar = QUEUETYPE.free(); \
 		assert(freevar); \
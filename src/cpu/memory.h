@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "clause.h"
 #include "vector.h"
 #include "logging.h"
+#include "constants.h"
 #include <cstdint>
 #include <limits>
 #include <cassert>
@@ -112,6 +113,14 @@ namespace ParaFROST {
             assert(sz > 0);
             return oldSz;
         }
+        inline void     shrinkTo    (const S& newSz) {
+            assert(newSz <= sz);
+            sz = newSz, _junk = 0;
+            if (!sz) return;
+            cap = sz;
+            assert(_bucket);
+            pfralloc(_mem, _bucket * cap);
+        }
         inline void     migrateTo   (SMM& newBlock) {
             if (newBlock._mem != NULL) std::free(newBlock._mem);
             newBlock._mem = _mem, newBlock.sz = sz, newBlock.cap = cap, newBlock._junk = _junk;
@@ -127,52 +136,87 @@ namespace ParaFROST {
     typedef SMM<Byte, C_REF> CTYPE;
     class CMM : public CTYPE
     {
+        // an 8-byte LRAT id precedes every clause
+        bool _ids;
+
     public:
 
-        Vec<bool, C_REF> stencil;
+        // one deletion bit per 4-byte clause-start word
+        Vec<uint64, C_REF> stencil;
 
-        CMM() { 
+        CMM() : _ids(false) { 
             assert(CTYPE::bucket() == 1);
             assert(hc_isize == sizeof(uint32));
             assert(hc_csize == sizeof(CLAUSE)); 
         }
-        explicit				CMM             (const C_REF& init_cap) : CTYPE(init_cap), stencil(init_cap, 0) { assert(CTYPE::bucket() == 1); }
-        inline void				init            (const C_REF& init_cap) { CTYPE::init(init_cap), stencil.resize(init_cap, 0); }
+        explicit				CMM             (const C_REF& init_cap, const bool& ids = false) : CTYPE(init_cap), _ids(ids), stencil(STENCIL_WORD(init_cap) + 1, 0) { assert(CTYPE::bucket() == 1); }
+        inline void				storeIds        (const bool& ids) { assert(!size()); _ids = ids; }
+        inline bool				storesIds       () const { return _ids; }
+        inline size_t			lead            () const { return _ids ? sizeof(uint64) : 0; }
+        inline void				init            (const C_REF& init_cap) { CTYPE::init(init_cap), stencil.resize(STENCIL_WORD(init_cap) + 1, 0); }
         inline		 CLAUSE&    operator[]		(const C_REF& r) { return (CLAUSE&)CTYPE::operator[](r); }
         inline const CLAUSE&    operator[]		(const C_REF& r) const { return (CLAUSE&)CTYPE::operator[](r); }
         inline		 CLAUSE*    clause          (const C_REF& r) { return (CLAUSE*)address(r); }
         inline const CLAUSE*    clause          (const C_REF& r) const { return (CLAUSE*)address(r); }
-        inline bool				deleted         (const C_REF& r) const { assert(check(r)); return stencil[r]; }
-        inline void				collectClause   (const C_REF& r, const int& size) { CTYPE::collect(bytes(size)); assert(check(r)); stencil[r] = true; }
+        inline bool				deleted         (const C_REF& r) const { assert(check(r)); return stencil[STENCIL_WORD(r)] & STENCIL_BIT(r); }
+        inline void				collectClause   (const C_REF& r, const int& size) { CTYPE::collect(bytes(size)); assert(check(r)); stencil[STENCIL_WORD(r)] |= STENCIL_BIT(r); }
         inline void				collectLiterals (const int& size) { CTYPE::collect(size * hc_isize); }
+        inline void				compactTo       (const C_REF& newSz) {
+            CTYPE::shrinkTo(newSz);
+            stencil.clear();
+            stencil.resize(STENCIL_WORD(newSz) + 1, 0);
+            stencil.shrinkCap();
+        }
         inline void				migrateTo       (CMM& dest) {
             CTYPE::migrateTo(dest);
             stencil.migrateTo(dest.stencil);
+            dest._ids = _ids;
+        }
+        inline void				checkRef        (const C_REF& r) const {
+            assert(!(r & 3));
+            if (r >= MAX_WREF) {
+                PFLOGEN("clause reference (%zd) exceeds the watch addressable limit (%zd)", r, C_REF(MAX_WREF));
+                throw MEMOUTEXCEPTION();
+            }
         }
         template <class SRC>
         inline C_REF			alloc           (const SRC& src) {
             assert(src.size() > 1);
             size_t cBytes = bytes(src.size());
-            C_REF r = CTYPE::alloc(cBytes);
+            C_REF r = CTYPE::alloc(cBytes) + lead();
+            checkRef(r);
             new (clause(r)) CLAUSE(src);
-            assert(clause(r)->capacity() == cBytes);
+            if (_ids) clause(r)->set_lratid(0);
+            assert(clause(r)->capacity() + lead() == cBytes);
             assert(src.size() == clause(r)->size());
-            stencil.expand(r + 1, 0);
+            stencil.expand(STENCIL_WORD(r) + 1, 0);
             return r;
         }
         inline C_REF			alloc           (const int& size) {
             assert(size > 1);
             size_t cBytes = bytes(size);
-            C_REF r = CTYPE::alloc(cBytes);
+            C_REF r = CTYPE::alloc(cBytes) + lead();
+            checkRef(r);
             new (clause(r)) CLAUSE(size);
-            assert(clause(r)->capacity() == cBytes);
+            if (_ids) clause(r)->set_lratid(0);
+            assert(clause(r)->capacity() + lead() == cBytes);
             assert(size == clause(r)->size());
-            stencil.expand(r + 1, 0);
+            stencil.expand(STENCIL_WORD(r) + 1, 0);
+            return r;
+        }
+        // appends 'n' bytes of ready-made clause images
+        inline C_REF			bulk            (const Byte* src, const size_t& n) {
+            assert(n >= hc_csize);
+            assert(!_ids);
+            C_REF r = CTYPE::alloc(n);
+            checkRef(r);
+            std::memcpy(address(r), src, n);
+            stencil.expand(STENCIL_WORD(r + n) + 1, 0);
             return r;
         }
         inline size_t			bytes           (const int& size) {
             assert(size > 1);
-            return (hc_csize + (size_t(size) - 2) * hc_isize);
+            return (lead() + hc_csize + (size_t(size) - 2) * hc_isize);
         }
         inline void				destroy         () { dealloc(), stencil.clear(true); }
     };
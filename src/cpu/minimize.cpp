@@ -46,20 +46,22 @@ void Solver::minimizebin()
 	uint32 *j, *end = learntC.end();
 	for (j = learntC + 1; j != end; j++)
 		sp->board[ABS(*j)] = marker;
-	WL& ws = wt[uip];
+	BL& bs = bt[uip];
 	int nLitsRem = 0;
 	const int size = learntC.size() - 1;
-	forall_watches(ws, i) {
-		const WATCH w = *i;
-		if (w.binary()) {
-			const uint32 other = w.imp, v = ABS(other);
-			if (sp->board[v] == marker && isTrue(other)) {
-				sp->board[v] = unmarker;
-				sp->seen[v] = 0; // see no evil!
-				nLitsRem++;
+	forall_bwatches(bs, i) {
+		const uint32 other = i->imp, v = ABS(other);
+		if (sp->board[v] == marker && isTrue(other)) {
+			if (opts.lrat_en) {
+				if (cm.deleted(i->ref())) continue;
+				proof.hint(cm[i->ref()].lratid());
+				minimized.push(v);
 			}
+			sp->board[v] = unmarker;
+			sp->seen[v] = 0; // see no evil!
+			nLitsRem++;
+			if (nLitsRem == size) break; // bail out early
 		}
-		if (nLitsRem == size) break; // bail out early
 	}
 	if (nLitsRem) {
 		assert(end == learntC.end());
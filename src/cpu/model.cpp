@@ -18,6 +18,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "model.h"
 #include "dimacs.h"
+#include <thread>
 
 using namespace ParaFROST;
 
@@ -63,19 +64,77 @@ void MODEL::printResolved()
 	PRINT(")%s\n", CNORMAL);
 }
 
-void MODEL::print()
+static const char digitPairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+// writes 'n' in decimal two digits at a time and returns the end
+inline char* writeDecimal(char* out, uint32 n)
+{
+	char digits[10];
+	char* p = digits + sizeof(digits);
+	while (n >= 100) {
+		const uint32 pair = (n % 100) << 1;
+		n /= 100;
+		*--p = digitPairs[pair + 1];
+		*--p = digitPairs[pair];
+	}
+	if (n >= 10) {
+		*--p = digitPairs[(n << 1) + 1];
+		*--p = digitPairs[n << 1];
+	}
+	else *--p = char('0' + n);
+	const size_t len = digits + sizeof(digits) - p;
+	std::memcpy(out, p, len);
+	return out + len;
+}
+
+void MODEL::write(FILE* out)
+{
+	char* buffer = pfmalloc<char>(MODEL_BUFFER);
+	char* limit = buffer + MODEL_BUFFER - MODEL_MAXLIT;
+	char* p = buffer;
+	*p++ = 'v', *p++ = ' ';
+	for (uint32 v = 1; v <= maxVar; v++) {
+		*p++ = value[v] ? ' ' : '-';
+		p = writeDecimal(p, v);
+		*p++ = ' ';
+		if (breakmodel(v, 15)) *p++ = '\n', *p++ = 'v', *p++ = ' ';
+		if (p >= limit) {
+			fwrite(buffer, 1, p - buffer, out);
+			p = buffer;
+		}
+	}
+	*p++ = '\n';
+	fwrite(buffer, 1, p - buffer, out);
+	std::free(buffer);
+}
+
+void MODEL::print(arg_t path)
 {
 	if (!extended) {
 		PFLOGEN("model is not extended yet");
 		return;
 	}
-	PRINT("v ");
-	for (uint32 v = 1; v <= maxVar; v++) {
-		PRINT("%c%d ", value[v] ? ' ' : '-', v);
-		breakmodel(v, 15);
+	if (path == NULL) {
+		write(stdout);
+		if (!quiet_en) PFLOG0("");
+		return;
 	}
-	PUTCH('\n');
-	if (!quiet_en) PFLOG0("");
+	FILE* out = fopen(path, "w");
+	if (out == NULL) PFLOGE("cannot open model file \"%s\"", path);
+	write(out);
+	if (ferror(out)) PFLOGE("cannot write model file \"%s\"", path);
+	fclose(out);
+	PFLOG2(1, " Model of %s%d variables%s written to \"%s%s%s\"", CREPORTVAL, maxVar, CNORMAL, CREPORTVAL, path, CNORMAL);
 }
 
 void MODEL::init(uint32* _vorg)
@@ -179,7 +238,7 @@ void MODEL::verify(const string& path) {
 			orgClauses = toInteger(str, sign);
 			if (sign) PFLOGE("number of clauses in header is negative");
 			if (orgClauses == 0) PFLOGE("zero number of clauses in header");
-			PFLOG2(1, "  found header %s%d %d%s", CREPORTVAL, orgVars, orgClauses, CNORMAL);
+			PFLOG2(1, "  found header %s%d %lld%s", CREPORTVAL, orgVars, orgClauses, CNORMAL);
 			if (orgVars != maxVar) {
 				PFLOGEN("variables in header inconsistent with model variables");
 				verified = false;
@@ -197,12 +256,16 @@ void MODEL::verify(const string& path) {
 	inputFile.close();
 #endif
 	timer.stop();
-	timer.parse = timer.cpuTime();
-	PFLOG2(1, "  checked %s%d Variables%s, %s%d Clauses%s, and %s%d Literals%s in %s%.2f seconds%s",
+	printVerdict(timer.cpuTime());
+}
+
+void MODEL::printVerdict(const double& time)
+{
+	PFLOG2(1, "  checked %s%d Variables%s, %s%lld Clauses%s, and %s%lld Literals%s in %s%.2f seconds%s",
 		CREPORTVAL, orgVars, CNORMAL,
 		CREPORTVAL, orgClauses, CNORMAL,
 		CREPORTVAL, orgLiterals, CNORMAL,
-		CREPORTVAL, timer.parse, CNORMAL);
+		CREPORTVAL, time, CNORMAL);
 	if (verified) {
 		PRINT("c model %sVERIFIED%s\n", CGREEN, CNORMAL);
 	}
@@ -211,6 +274,77 @@ void MODEL::verify(const string& path) {
 	}
 }
 
+struct VCHUNK {
+	const uint32 *begin, *end, *failed;
+	uint64 clauses, literals, failures;
+};
+
+void MODEL::verify(const int& nthreads)
+{
+	if (!extended) {
+		PFLOGEN("model is not extended yet");
+		return;
+	}
+	assert(nthreads > 0);
+	const uint32* begin = orgcnf.data(), * end = orgcnf.end();
+	const size_t size = orgcnf.size();
+	const int n = (int)MAX(size_t(1), MIN(size_t(nthreads), size / VERIFY_MIN_CHUNK));
+	PFLOG2(1, " ");
+	PFLOG2(1, " Verifying model on kept input clauses using %s%d threads%s..", CREPORTVAL, n, CNORMAL);
+	TIMER timer;
+	timer.start();
+	// split at clause ends so every chunk holds whole clauses
+	VCHUNK* chunks = new VCHUNK[n];
+	const size_t step = size / n;
+	const uint32* from = begin;
+	for (int i = 0; i < n; i++) {
+		VCHUNK& chunk = chunks[i];
+		const uint32* to = (i == n - 1) ? end : MAX(from, begin + step * size_t(i + 1));
+		while (to < end && to > begin && to[-1]) to++;
+		chunk.begin = from, chunk.end = to;
+		chunk.failed = NULL;
+		chunk.clauses = chunk.literals = chunk.failures = 0;
+		from = to;
+	}
+	auto scan = [this](VCHUNK* chunk) {
+		const uint32* p = chunk->begin, * end = chunk->end;
+		while (p < end) {
+			const uint32* clause = p;
+			bool sat = false;
+			while (*p) {
+				if (!sat && satisfied(*p)) sat = true;
+				p++;
+			}
+			chunk->literals += uint64(p - clause);
+			chunk->clauses++;
+			if (!sat && !chunk->failures++) chunk->failed = clause;
+			p++;
+		}
+	};
+	if (n == 1) scan(chunks);
+	else {
+		std::thread* workers = new std::thread[n];
+		for (int i = 0; i < n; i++) workers[i] = std::thread(scan, chunks + i);
+		for (int i = 0; i < n; i++) workers[i].join();
+		delete[] workers;
+	}
+	orgVars = maxVar, orgClauses = orgLiterals = 0;
+	Lits_t org;
+	for (int i = 0; i < n; i++) {
+		const VCHUNK& chunk = chunks[i];
+		orgClauses += chunk.clauses, orgLiterals += chunk.literals;
+		if (!chunk.failures) continue;
+		verified = false;
+		org.clear();
+		for (const uint32* k = chunk.failed; *k; k++) org.push(*k);
+		PFLOGN2(1, "  thread %d found %lld clauses with no satisfied literals, first:\t", i, chunk.failures);
+		if (verbose >= 1) printClause(org, true);
+	}
+	delete[] chunks;
+	timer.stop();
+	printVerdict(timer.cpuTime());
+}
+
 bool MODEL::verify(char*& str)
 {
 	Lits_t org;
@@ -24,11 +24,22 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace ParaFROST {
 
+	// model lines are formatted in a buffer of this size
+	constexpr size_t MODEL_BUFFER = (1ULL << 22);
+
+	// "\nv " + sign + 10 digits + ' '
+	constexpr size_t MODEL_MAXLIT = 16;
+
+	// minimum kept literals scanned by one verification thread
+	constexpr size_t VERIFY_MIN_CHUNK = (1ULL << 20);
+
 	struct MODEL {
 		Vec<LIT_ST> value, marks;
 		uVec1D lits, resolved;
+		Vec<uint32, size_t> orgcnf; // input clauses in original literals, each ending with 0
 		LIT_ST* orgvalues;
-		uint32 *vorg, maxVar, orgVars, orgClauses, orgLiterals;
+		uint32 *vorg, maxVar, orgVars;
+		uint64 orgClauses, orgLiterals;
 		bool extended, verified;
 		MODEL() :
 			orgvalues(NULL)
@@ -43,15 +54,23 @@ namespace ParaFROST {
 			marks.clear(true);
 			value.clear(true);
 			resolved.clear(true);
+			orgcnf.clear(true);
 		}
 		void			init			(uint32*);
-		void			print			();
+		void			print			(arg_t path = NULL);
+		void			write			(FILE*);
 		void			printResolved	();
 		void			printValues		();
 		void			printClause		(const Lits_t&, const bool&);
 		void			extend			(LIT_ST*);
 		void			verify			(const string&);
 		bool			verify			(char*& clause);
+		void			verify			(const int& nthreads);
+		void			printVerdict	(const double& time);
+		inline void		saveOriginal	(const Lits_t& org) {
+			for (int i = 0; i < org.size(); i++) orgcnf.push(org[i]);
+			orgcnf.push(0);
+		}
 		inline bool		satisfied		(const uint32& orglit) const;
 		inline uint32	size			()					const { return extended ? value.size() - 1 : 0; }
 		inline int		lit2int			(const uint32& lit) const { return SIGN(lit) ? -int(ABS(lit)) : int(ABS(lit)); }
@@ -63,7 +82,7 @@ namespace ParaFROST {
 		void			saveBinary		(const uint32& witness, const uint32& other);
 		void			saveClause		(uint32* lits, const int& size, const uint32& witlit);
 
-		#define	breakmodel(X, LEN) if (X > 1 && X < maxVar - 2 && X % LEN == 0) { PRINT("\nv "); }
+		#define	breakmodel(X, LEN) (X > 1 && X < maxVar - 2 && X % LEN == 0)
 
 	};
 
@@ -52,6 +52,7 @@ BOOL_OPT opt_boundsearch_en("boundsearch", "activate search bounds on decisions
 BOOL_OPT opt_chrono_en("chrono", "enable chronological backtracking", true);
 BOOL_OPT opt_bumpreason_en("bumpreason", "bump reason literals via learnt clause", true);
 BOOL_OPT opt_debinary_en("debinary", "remove duplicated binaries", true);
+BOOL_OPT opt_garbage_inplace_en("garbageinplace", "compact clause memory in place instead of copying it to a new block", false);
 BOOL_OPT opt_decompose_en("decompose", "decompose binary implication gragh into SCCs", true);
 BOOL_OPT opt_targetphase_en("targetphase", "use target phase in decision making", true);
 BOOL_OPT opt_targetonly_en("targetonly", "use only target phase", false);
@@ -63,12 +64,15 @@ BOOL_OPT opt_parseincr_en("parseincr", "parse input formula incrementally", fals
 BOOL_OPT opt_polarity("polarity", "initial variable polarity", true);
 BOOL_OPT opt_proof_en("proof", "enable DRAT proof generation (default: binary)", false);
 BOOL_OPT opt_proof_nonbinary_en("proofnonbinary", "generate proof in binary DRAT format", false);
+BOOL_OPT opt_lrat_en("lrat", "generate LRAT proof with clause hints (implies proof)", false);
 BOOL_OPT opt_probe_en("probe", "enable failed literal probing", true);
 BOOL_OPT opt_probe_sleep_en("probesleep", "allow failed literal probing to sleep", true);
 BOOL_OPT opt_probehbr_en("probehyper", "learn hyper binary clauses", true);
 BOOL_OPT opt_model_en("model", "extend model with eliminated variables", false);
 BOOL_OPT opt_modelprint_en("modelprint", "print model on stdout", false);
 BOOL_OPT opt_modelverify_en("modelverify", "verify model on input formula", false);
+BOOL_OPT opt_dedup_en("dedup", "remove duplicate clauses while parsing", false);
+BOOL_OPT opt_modelverifymem_en("modelverifymem", "keep input clauses in memory to verify the model without re-parsing", false);
 BOOL_OPT opt_mdmlcv_en("mdmlcv", "use least-constrained variables to make multiple decisions", false);
 BOOL_OPT opt_mdmwalk_en("mdmwalk", "enable walk within an initial mdm round", true);
 BOOL_OPT opt_report_en("report", "allow performance report on stdout", true);
@@ -77,6 +81,8 @@ BOOL_OPT opt_reduce_en("reduce", "enable learnt database reduction", true);
 BOOL_OPT opt_sigpre_en("sigma", "enable preprocessing using SIGmA", true);
 BOOL_OPT opt_siglive_en("sigmalive", "enable live SIGmA (inprocessing)", true);
 BOOL_OPT opt_sigsleep_en("sigmasleep", "allow SIGmA to sleep", true);
+BOOL_OPT opt_simdparse_en("simdparse", "use SIMD (AVX2 if supported) to tokenize DIMACS clauses", true);
+BOOL_OPT opt_simdsearch_en("simdsearch", "use AVX2 (if supported) to search for new watches in long clauses", true);
 BOOL_OPT opt_subsume_en("subsume", "enable forward subsumption elimination", true);
 BOOL_OPT opt_stable_en("stable", "enable variable phases stabilization based on restarts", true);
 BOOL_OPT opt_vsids_en("vsids", "enable VSIDS (VMFQ otherwise)", true);
@@ -96,7 +102,7 @@ INT_OPT opt_minimize_min("minimizemin", "minimum learnt size to do binary streng
 INT_OPT opt_minimize_depth("minimizedepth", "minimization depth to explore", 1e3, INT32R(1, INT32_MAX));
 INT_OPT opt_mode_inc("modeinc", "mode increment value based on conflicts", 1e3, INT32R(1, INT32_MAX));
 INT_OPT opt_nap("nap", "maximum naping period", 2, INT32R(0, 10));
-INT_OPT opt_ternary_priorbins("ternarypriorbins", "prioritize binaries in watch table after hyper ternary resolution (1: enable, 2: prioritize learnts)", 0, INT32R(0, 2));
+INT_OPT opt_ternary_priorbins("ternarypriorbins", "order of binary lists after hyper ternary resolution (2: learnts first, otherwise originals first)", 0, INT32R(0, 2));
 INT_OPT opt_ternary_max_eff("ternarymaxeff", "maximum hyper ternary resolution efficiency", 1e2, INT32R(0, INT32_MAX));
 INT_OPT opt_ternary_min_eff("ternarymineff", "minimum hyper ternary resolution efficiency", 1e6, INT32R(0, INT32_MAX));
 INT_OPT opt_ternary_rel_eff("ternaryreleff", "relative hyper ternary resolution efficiency per mille", 40, INT32R(0, 1000));
@@ -115,19 +121,19 @@ INT_OPT opt_probe_rel_eff("probereleff", "relative probe efficiency per mille",
 INT_OPT opt_seed("seed", "initial seed value for the random generator", 1008001, INT32R(1, INT32_MAX));
 INT_OPT opt_sigma_inc("sigmainc", "live sigma increment value based on conflicts", 500, INT32R(1, INT32_MAX));
 INT_OPT opt_sigma_min("sigmamin", "minimum root variables shrunken to awaken SIGmA", 4e3, INT32R(1, INT32_MAX));
-INT_OPT opt_sigma_priorbins("sigmapriorbins", "prioritize binaries in watch table after sigmification (1: enable, 2: prioritize learnts)", 1, INT32R(0, 2));
-INT_OPT opt_subsume_priorbins("subsumepriorbins", "prioritize binaries in watch table after subsume (1: enable, 2: prioritize learnts)", 1, INT32R(0, 2));
+INT_OPT opt_sigma_priorbins("sigmapriorbins", "order of binary lists after sigmification (2: learnts first, otherwise originals first)", 1, INT32R(0, 2));
+INT_OPT opt_subsume_priorbins("subsumepriorbins", "order of binary lists after subsume (2: learnts first, otherwise originals first)", 1, INT32R(0, 2));
 INT_OPT opt_subsume_inc("subsumeinc", "forward subsumption increment value based on conflicts", 2e3, INT32R(100, INT32_MAX));
 INT_OPT opt_subsume_max_occs("subsumemaxoccurs", "maximum occurrences to subsume or strengthen", 3e3, INT32R(10, INT32_MAX));
 INT_OPT opt_subsume_max_csize("subsumemaxcsize", "maximum subsuming clause size", 1e3, INT32R(2, INT32_MAX));
 INT_OPT opt_subsume_max_eff("subsumemaxeff", "maximum number of clauses to scan in subsume", 1e2, INT32R(0, INT32_MAX));
 INT_OPT opt_subsume_min_eff("subsumemineff", "minimum number of clauses to scan in subsume", 1e6, INT32R(0, INT32_MAX));
 INT_OPT opt_subsume_rel_eff("subsumereleff", "relative subsume efficiency per mille", 1e4, INT32R(0, INT32_MAX));
-INT_OPT opt_vivify_priorbins("vivifypriorbins", "prioritize binaries in watch table before vivification (1: enable, 2: prioritize learnts)", 0, INT32R(0, 2));
+INT_OPT opt_vivify_priorbins("vivifypriorbins", "order of binary lists before vivification (2: learnts first, otherwise originals first)", 0, INT32R(0, 2));
 INT_OPT opt_vivify_max_eff("vivifymaxeff", "maximum vivify efficiency", 50, INT32R(0, INT32_MAX));
 INT_OPT opt_vivify_min_eff("vivifymineff", "minimum vivify efficiency", 2e5, INT32R(0, INT32_MAX));
 INT_OPT opt_vivify_rel_eff("vivifyreleff", "relative vivify efficiency per mille", 2, INT32R(0, 1000));
-INT_OPT opt_walk_priorbins("walkpriorbins", "prioritize binaries in watch table after walking (1: enable, 2: prioritize learnts)", 1, INT32R(0, 2));
+INT_OPT opt_walk_priorbins("walkpriorbins", "order of binary lists after walking (2: learnts first, otherwise originals first)", 1, INT32R(0, 2));
 INT_OPT opt_walk_max_eff("walkmaxeff", "maximum Walksat efficiency", 1e2, INT32R(0, INT32_MAX));
 INT_OPT opt_walk_min_eff("walkmineff", "minimum Walksat efficiency", 1e7, INT32R(0, INT32_MAX));
 INT_OPT opt_walk_rel_eff("walkreleff", "relative Walksat efficiency per mille", 10, INT32R(0, 1000));
@@ -140,6 +146,15 @@ INT_OPT opt_luby_max("lubymax", "luby sequence maximum value", 1 << 20, INT32R(1
 INT_OPT opt_learntsub_max("subsumelearntmax", "maximum learnt clauses to subsume", 20, INT32R(0, INT32_MAX));
 INT64_OPT opt_conflictout("conflictout", "set out-of-conflicts limit (must be enabled by \"boundsearch\")", INT64_MAX, INT64R(0, INT64_MAX));
 INT64_OPT opt_decisionout("decisionout", "set out-of-decisions limit (must be enabled by \"boundsearch\")", INT64_MAX, INT64R(0, INT64_MAX));
+INT_OPT opt_cache_size("cachesize", "maximum size of the simplified formulas cache in megabytes", 4096, INT32R(1, INT32_MAX));
+INT_OPT opt_proof_buffer("proofbuffer", "size of each proof buffer in kilobytes", 4096, INT32R(1, 1 << 20));
+INT_OPT opt_proof_queue("proofqueue", "number of proof buffers in flight to the writer thread (1: write on the solver thread)", 4, INT32R(1, 64));
+INT_OPT opt_proof_level("prooflevel", "compression level of proof files ending in .gz or .zst (0: codec default)", 0, INT32R(0, 22));
+INT_OPT opt_verify_threads("verifythreads", "number of threads verifying the model on kept input clauses", 4, INT32R(1, 256));
+INT_OPT opt_ve_threads("vethreads", "number of threads planning bounded variable elimination (1: sequential)", 1, INT32R(1, 256));
+INT_OPT opt_parse_threads("parsethreads", "number of threads tokenizing the input file (1: sequential parsing)", 1, INT32R(1, 256));
+INT_OPT opt_prefetch_lookahead("prefetchlookahead", "number of non-blocked watches whose clauses are prefetched ahead in search propagation (0: disable)", 8, INT32R(0, 64));
+INT_OPT opt_simdsearch_min("simdsearchmin", "minimum clause size to use SIMD search for new watches", 16, INT32R(8, INT32_MAX));
 DOUBLE_OPT opt_stable_rate("stablerestartrate", "stable restart increase rate", 1.0, FP64R(1, 5));
 DOUBLE_OPT opt_lbd_rate("lbdrate", "slow rate in firing lbd restarts", 1.1, FP64R(1, 10));
 DOUBLE_OPT opt_ternary_perc("ternaryperc", "percentage of maximum hyper clauses to add", 0.2, FP64R(0, 1));
@@ -148,13 +163,21 @@ DOUBLE_OPT opt_reduce_perc("reduceperc", "percentage of learnt clauses to reduce
 DOUBLE_OPT opt_var_inc("varinc", "VSIDS increment value", 1.0, FP64R(1, 10));
 DOUBLE_OPT opt_var_decay("vardecay", "VSIDS decay value", 0.95, FP64R(0, 1));
 DOUBLE_OPT opt_garbage_perc("garbageperc", "collect garbage if its percentage exceeds this value", 0.25, FP64R(0, 1));
-STRING_OPT opt_proof_out("proofout", "output file to write binary proof", "proof.out");
+STRING_OPT opt_proof_out("proofout", "output file to write binary proof (compressed if ending in .gz or .zst)", "proof.out");
+STRING_OPT opt_snapshot_out("writebinary", "write the parsed formula in binary format to the given file", "");
+STRING_OPT opt_model_out("modelout", "write the model to the given file instead of stdout", "");
+STRING_OPT opt_cache_dir("cachedir", "directory caching simplified formulas by input content and simplifier options (the input is hashed in an extra pass before parsing)", "");
+STRING_OPT opt_simplified_out("writesimplified", "write the formula simplified by the first sigmify with its model reconstruction to the given file", "");
 
 OPTION::OPTION() 
 {
 	RESETSTRUCT(this);
 	int MAXLEN = 256;
 	proof_path = pfcalloc<char>(MAXLEN);
+	snapshot_path = pfcalloc<char>(MAXLEN);
+	simplified_path = pfcalloc<char>(MAXLEN);
+	cache_path = pfcalloc<char>(MAXLEN);
+	model_path = pfcalloc<char>(MAXLEN);
 }
 
 OPTION::~OPTION() 
@@ -163,6 +186,22 @@ OPTION::~OPTION()
 		std::free(proof_path);
 		proof_path = NULL;
 	}
+	if (snapshot_path != NULL) {
+		std::free(snapshot_path);
+		snapshot_path = NULL;
+	}
+	if (simplified_path != NULL) {
+		std::free(simplified_path);
+		simplified_path = NULL;
+	}
+	if (cache_path != NULL) {
+		std::free(cache_path);
+		cache_path = NULL;
+	}
+	if (model_path != NULL) {
+		std::free(model_path);
+		model_path = NULL;
+	}
 }
 
 void OPTION::init() 
@@ -175,13 +214,15 @@ void OPTION::init()
 	conflict_out		= opt_conflictout;
 	decision_out		= opt_decisionout;
 	debinary_en			= opt_debinary_en;
+	gc_inplace_en		= opt_garbage_inplace_en;
 	decompose_en		= opt_decompose_en;
 	decompose_min		= opt_decompose_min;
 	decompose_limit		= opt_decompose_limit;
 	decompose_min_eff	= opt_decompose_min_eff;
 	model_en			= opt_model_en;
 	modelprint_en		= opt_modelprint_en;
-	modelverify_en		= opt_modelverify_en;
+	modelverify_en		= opt_modelverify_en || opt_modelverifymem_en;
+	modelverifymem_en	= opt_modelverifymem_en;
 	mode_inc			= opt_mode_inc;
 	minimize_min		= opt_minimize_min;
 	minimize_lbd		= opt_minimize_lbd;
@@ -195,10 +236,20 @@ void OPTION::init()
 	map_perc			= opt_map_perc;
 	nap					= opt_nap;
 	memcpy(proof_path, opt_proof_out, opt_proof_out.length());
+	memcpy(snapshot_path, opt_snapshot_out, opt_snapshot_out.length());
+	memcpy(simplified_path, opt_simplified_out, opt_simplified_out.length());
+	memcpy(cache_path, opt_cache_dir, opt_cache_dir.length());
+	memcpy(model_path, opt_model_out, opt_model_out.length());
+	cache_size			= opt_cache_size;
 	parseonly_en		= opt_parseonly_en;
+	dedup_en			= opt_dedup_en;
 	parseincr_en		= opt_parseincr_en;
 	proof_en			= opt_proof_en;
 	proof_nonbinary_en	= opt_proof_nonbinary_en;
+	lrat_en				= opt_lrat_en;
+	proof_buffer		= opt_proof_buffer;
+	proof_queue			= opt_proof_queue;
+	proof_level			= opt_proof_level;
 	probe_en			= opt_probe_en;
 	probe_sleep_en		= opt_probe_sleep_en;
 	probehbr_en			= opt_probehbr_en;
@@ -268,13 +319,22 @@ void OPTION::init()
 	luby_max			= opt_luby_max;
 	learntsub_max		= opt_learntsub_max;
 	gc_perc				= opt_garbage_perc;
+	simdsearch_en		= opt_simdsearch_en;
+	simdparse_en		= opt_simdparse_en;
+	simdsearch_min		= opt_simdsearch_min;
+	prefetch_lookahead	= opt_prefetch_lookahead;
+	parse_threads		= opt_parse_threads;
+	ve_threads			= opt_ve_threads;
+	verify_threads		= opt_verify_threads;
 	// SAT competition mode
 	if (competition_en) {
 		assert(proof_path);
 		quiet_en = true, report_en = false;
 		proof_en = true, proof_nonbinary_en = false;
-		model_en = true, modelprint_en = true, modelverify_en = false;
+		model_en = true, modelprint_en = true, modelverify_en = modelverifymem_en = false;
 	}
+	if (lrat_en) proof_en = true;
+	if (*model_path) model_en = true;
 	// initialize simplifier options
 	if (sigma_en || sigma_live_en) {
 		all_en				= opt_all_en;
@@ -32,6 +32,10 @@ namespace ParaFROST {
 		LIT_ST	polarity;
 		//------------------------------------------//
 		char*	proof_path;
+		char*	snapshot_path;
+		char*	simplified_path;
+		char*	cache_path;
+		char*	model_path;
 		//------------------------------------------//
 		int64	learntsub_max;
 		//------------------------------------------//
@@ -47,6 +51,13 @@ namespace ParaFROST {
 		double	ternary_perc;
 		//------------------------------------------//
 		int		nap;
+		int		simdsearch_min;
+		int		prefetch_lookahead;
+		int		parse_threads;
+		int		ve_threads;
+		int		verify_threads;
+		int		proof_buffer, proof_queue, proof_level;
+		int		cache_size;
 		int		seed;
 		int		prograte;
 		int		mode_inc;
@@ -82,15 +93,19 @@ namespace ParaFROST {
 		bool	boundsearch_en;
 		bool	decompose_en;
 		bool	debinary_en;
+		bool	gc_inplace_en;
+		bool	simdsearch_en;
+		bool	simdparse_en;
 		bool	transitive_en;
 		bool	targetonly_en, targetphase_en;
 		bool	ternary_en, ternary_sleep_en;
 		bool	autarky_en, autarky_sleep_en;
-		bool	proof_en, proof_nonbinary_en;
+		bool	proof_en, proof_nonbinary_en, lrat_en;
 		bool	parseonly_en, parseincr_en;
+		bool	dedup_en;
 		bool	vsids_en, vsidsonly_en;
 		bool	probe_en, probehbr_en, probe_sleep_en;
-		bool	model_en, modelprint_en, modelverify_en;
+		bool	model_en, modelprint_en, modelverify_en, modelverifymem_en;
 		bool	mdm_walk_en, mdm_mcv_en;
 		//==========================================//
 		//             Simplifier options           //
@@ -173,21 +173,27 @@ void Solver::printOccurs(const uint32& v)
 void Solver::printWL(const uint32& lit, const bool& bin)
 {
 	CHECKLIT(lit);
+	const BL& bs = bt[lit];
 	const WL& ws = wt[lit];
-	if (ws.size()) PFLOG1("  list(%d):", -l2i(lit));
-	for (int i = 0; i < ws.size(); i++) {
-		if (!ws[i].binary() && bin) continue;
-		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
-			CLOGGING, ws[i].ref, ws[i].size, l2i(ws[i].imp), CNORMAL);
-	}
+	if (bs.size() || (ws.size() && !bin)) PFLOG1("  list(%d):", -l2i(lit));
+	printBL(bs);
+	if (!bin) printWL(ws);
 }
 
 void Solver::printWL(const WL& ws, const bool& bin)
 {
 	for (int i = 0; i < ws.size(); i++) {
 		if (!ws[i].binary() && bin) continue;
-		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
-			CLOGGING, ws[i].ref, ws[i].size, l2i(ws[i].imp), CNORMAL);
+		PFLCLAUSE(1, cm[ws[i].ref()], "  %sW(r: %-4zd, b: %-4d, i: %-4d)->%s",
+			CLOGGING, ws[i].ref(), ws[i].binary(), l2i(ws[i].imp), CNORMAL);
+	}
+}
+
+void Solver::printBL(const BL& bs)
+{
+	for (int i = 0; i < bs.size(); i++) {
+		PFLCLAUSE(1, cm[bs[i].ref()], "  %sB(r: %-4zd, l: %-4d, i: %-4d)->%s",
+			CLOGGING, bs[i].ref(), bs[i].learnt(), l2i(bs[i].imp), CNORMAL);
 	}
 }
 
@@ -20,9 +20,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 using namespace ParaFROST;
 
 struct PROBE_QUEUE_CMP {
-	const VSTATE* states;
+	CVSTATES states;
 	const Vec<uint64>& bumped;
-	PROBE_QUEUE_CMP(const VSTATE* _states, const Vec<uint64>& _bumped) :
+	PROBE_QUEUE_CMP(CVSTATES _states, const Vec<uint64>& _bumped) :
 		states(_states), bumped(_bumped) {}
 	uint64 operator () (const uint32& a, const uint32& b) const {
 		const uint32 av = ABS(a), bv = ABS(b);
@@ -34,9 +34,9 @@ struct PROBE_QUEUE_CMP {
 };
 
 struct PROBE_HEAP_CMP {
-	const VSTATE* states;
+	CVSTATES states;
 	const Vec<double>& act;
-	PROBE_HEAP_CMP(const VSTATE* _states, const Vec<double>& _act) :
+	PROBE_HEAP_CMP(CVSTATES _states, const Vec<double>& _act) :
 		states(_states), act(_act) {}
 	bool operator () (const uint32& a, const uint32& b) const {
 		const uint32 av = ABS(a), bv = ABS(b);
@@ -62,9 +62,10 @@ void Solver::analyzeFailed(const uint32& failed)
 	if (unassigned(failed)) {
 		const uint32 unit = FLIP(failed);
 		PFLOG2(3, "  found unassigned failed probe %d", l2i(unit));
-		enqueueUnit(unit);
+		if (opts.lrat_en) learnFailed(failed);
+		else enqueueUnit(unit);
 	}
-	if (BCP()) {
+	if (cnfstate && BCP()) {
 		PFLOG2(2, "  failed probe %d proved a contradiction", l2i(failed));
 		learnEmpty();
 	}
@@ -77,7 +78,7 @@ void Solver::scheduleProbes()
 	memset(vhist, 0, sizeof(uint32) * inf.nDualVars);
 	histBins(orgs);
 	histBins(learnts);
-	VSTATE* states = sp->vstate;
+	VSTATES states = sp->vstate;
 	uint32 count[2] = { 0 , 0 };
 	forall_variables(v) {
 		if (states[v].state) continue;
@@ -114,7 +115,7 @@ void Solver::FLE()
 	assert(sp->propagated == trail.size());
 	SLEEPING(sleep.probe, opts.probe_sleep_en);
 	SET_BOUNDS(probe_limit, probe, probeticks, searchticks, nlogn(maxActive()));
-	VSTATE* states = sp->vstate;
+	VSTATES states = sp->vstate;
 	ignore = NOREF;
 	int64 old_hypers = stats.binary.resolvents;
 	uint32 probe = 0, currprobed = 0, currfailed = 0;
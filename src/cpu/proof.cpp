@@ -19,12 +19,6 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "proof.h"
 #include "sort.h"
 
-#if defined(_WIN32) || defined(__CYGWIN__)
-	#define writebyte putc
-#elif defined(__linux__)
-	#define writebyte putc_unlocked
-#endif
-
 #define BYTEMAX			 128
 #define IBYTEMAX		-128
 #define BYTEMASK		 127
@@ -34,36 +28,48 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 using namespace ParaFROST;
 
 PROOF::PROOF() : 
-	proofFile(NULL)
-	, sp(NULL)
+	sp(NULL)
 	, vars(NULL)
+	, nextid(0)
+	, inputs(0)
+	, hints(0)
 	, added(0)
 	, nonbinary_en(false)
+	, lrat_en(false)
 	{}
 
 PROOF::~PROOF()
 { 
 	clause.clear(true);
 	tmpclause.clear(true);
+	units.clear(true);
+	chain.clear(true);
 	close();
-	vars = NULL, sp = NULL, proofFile = NULL;
+	vars = NULL, sp = NULL;
 }
 
-void PROOF::close()
-{
-	if (proofFile != NULL) {
-		fclose(proofFile);
-		proofFile = NULL;
-	}
-}
+void PROOF::close() { writer.close(); }
 
-void PROOF::handFile(arg_t path, const bool& _nonbinary_en)
+void PROOF::handFile(arg_t path, const bool& _nonbinary_en, const bool& _lrat_en, const size_t& blocksize, const int& queue, const int& level)
 {
+	const CODEC codec = suffixCodec(path);
+	// never write plain bytes under a compressed name nor to another path
+	if (codec != NOCODEC && !codecEncodes(codec))
+		PFLOGE("%s proofs are not supported by this build, use a proof file without the compression suffix", codecName(codec));
 	PFLOGN2(1, " Handing over \"%s%s%s\" to the proof system..", CREPORTVAL, path, CNORMAL);
-	proofFile = fopen(path, "w");
-	if (proofFile == NULL) PFLOGE("cannot open proof file %s", path);
+	if (!writer.open(path, blocksize, queue, codec, level)) PFLOGE("cannot open proof file %s", path);
 	nonbinary_en = _nonbinary_en;
-	PFLENDING(1, 5, "(binary %s)", nonbinary_en ? "disabled" : "enabled");
+	lrat_en = _lrat_en;
+	PFLENDING(1, 5, "(%s, binary %s, %s, %d x %zd KB buffers)", lrat_en ? "LRAT" : "DRAT", nonbinary_en ? "disabled" : "enabled", codecName(codec), queue, blocksize >> 10);
+}
+
+void PROOF::initLRAT(const uint32& orgvars, const uint64& orgclauses)
+{
+	assert(lrat_en);
+	assert(!nextid);
+	// ids of input clauses are their positions in the formula
+	nextid = orgclauses;
+	units.resize(orgvars + 1, 0);
 }
 
 void PROOF::init(SP* _sp)
@@ -82,14 +88,14 @@ void PROOF::init(SP* _sp, uint32* vorg)
 
 inline bool PROOF::checkFile()
 {
-	if (proofFile == NULL) {
+	if (!writer.opened()) {
 		PFLOGEN("proof file is not opened or cannot be accessed");
 		return false;
 	}
 	return true;
 }
 
-inline void PROOF::write(const Byte& byte) { writebyte(byte, proofFile); }
+inline void PROOF::write(const Byte& byte) { writer.put(byte); }
 
 inline void PROOF::write(const uint32* lits, const int& len)
 {
@@ -115,55 +121,153 @@ inline void	PROOF::delline(const uint32* lits, const int& len)
 	write(lits, len);
 }
 
+inline void PROOF::varint(uint64 n)
+{
+	while (ISLARGE(n)) {
+		write(Byte(L2B(n)));
+		n >>= 7;
+	}
+	write(Byte(n));
+}
+
+inline void PROOF::number(uint64 n)
+{
+	const size_t bytes = 24;
+	char digits[bytes];
+	char* tail = digits + bytes, * nstr = tail;
+	do {
+		*--nstr = (n % 10) + '0';
+		n /= 10;
+	} while (n);
+	while (nstr != tail) write(*nstr++);
+}
+
 inline void PROOF::binary(const uint32* lits, const int& len)
 {
 	for (int i = 0; i < len; i++) {
 		const uint32 lit = lits[i];
 		CHECKLIT(lit);
-		uint32 r = V2DEC(vars[ABS(lit)], SIGN(lit));
+		const uint32 r = V2DEC(vars[ABS(lit)], SIGN(lit));
 		assert(r > 1 && r < NOVAR);
-		Byte b;
-		while (ISLARGE(r)) {
-			b = L2B(r);
-			write(b);
-			r >>= 7;
-		}
-		b = r;
-		write(b);
+		varint(r);
 	}
 	write(0);
 }
 
 inline void PROOF::nonbinary(const uint32* lits, const int& len)
 {
-	const size_t bytes = 16;
-	const char delimiter = '0';
-	char line[bytes];
-	char* tail = line + bytes;
-	*--tail = 0;
 	for (int i = 0; i < len; i++) {
 		const uint32 lit = lits[i];
 		CHECKLIT(lit);
-		const uint32 mvar = vars[ABS(lit)];
-		const LIT_ST sign = SIGN(lit);
-		if (sign) write('-');
-		char* nstr = tail;
-		assert(!*nstr);
-		uint32 digit = mvar;
-		while (digit) {
-			*--nstr = (digit % 10) + delimiter;
-			digit /= 10;
-		}
-		while (nstr != tail) write(*nstr++);
+		if (SIGN(lit)) write('-');
+		number(vars[ABS(lit)]);
 		write(' ');
 	}
-	write(delimiter);
+	write('0');
 	write('\n');
 }
 
+// LRAT lines are "id lits 0 hints 0" in text and
+// 'a' id lits 0 hints 0 in binary with ids doubled
+inline void PROOF::lratline(const uint64& id, const uint32* lits, const int& len)
+{
+	assert(checkFile());
+	assert(id > inputs);
+	if (nonbinary_en) {
+		number(id);
+		write(' ');
+		for (int i = 0; i < len; i++) {
+			const uint32 lit = lits[i];
+			CHECKLIT(lit);
+			if (SIGN(lit)) write('-');
+			number(vars[ABS(lit)]);
+			write(' ');
+		}
+		write('0');
+		forall_vector(uint64, chain, h) {
+			write(' ');
+			number(*h);
+		}
+		write(' ');
+		write('0');
+		write('\n');
+	}
+	else {
+		write('a');
+		varint(id << 1);
+		for (int i = 0; i < len; i++) {
+			const uint32 lit = lits[i];
+			CHECKLIT(lit);
+			varint(V2DEC(vars[ABS(lit)], SIGN(lit)));
+		}
+		write(0);
+		forall_vector(uint64, chain, h) {
+			varint(*h << 1);
+		}
+		write(0);
+	}
+	hints += chain.size();
+	chain.clear();
+	added++;
+}
+
+inline void PROOF::lratdelete(const uint64& id)
+{
+	assert(checkFile());
+	if (!id) return; // never reached the proof
+	if (nonbinary_en) {
+		number(nextid);
+		write(' ');
+		write('d');
+		write(' ');
+		number(id);
+		write(' ');
+		write('0');
+		write('\n');
+	}
+	else {
+		write('d');
+		varint(id << 1);
+		write(0);
+	}
+	added++;
+}
+
+uint64 PROOF::original()
+{
+	assert(lrat_en);
+	if (++inputs > nextid) PFLOGE("more clauses than declared in the header cannot be given LRAT ids");
+	return inputs;
+}
+
+void PROOF::hintUnit(const uint32& lit)
+{
+	CHECKLIT(lit);
+	assert(sp != NULL && !sp->value[lit]);
+	const uint64 id = units[vars[ABS(lit)]];
+	assert(id);
+	chain.push(id);
+}
+
+void PROOF::refuteUnit(const uint32& unit)
+{
+	// the pending hints derive 'unit' which is falsified on the root,
+	// thus its root unit in front of them refutes the formula
+	hintUnit(unit);
+	const uint64 id = chain.back();
+	for (uint32 i = chain.size() - 1; i > 0; i--)
+		chain[i] = chain[i - 1];
+	chain[0] = id;
+}
+
 void PROOF::addEmpty() 
 { 
 	assert(checkFile());
+	if (lrat_en) {
+		assert(chain.size());
+		lratline(++nextid, NULL, 0);
+		return;
+	}
 	if (nonbinary_en) {
 		write('0');
 	}
@@ -178,19 +282,73 @@ inline void PROOF::addClause() { addline(clause, clause.size()); clause.clear();
 
 inline void PROOF::deleteClause() { delline(clause, clause.size()); clause.clear(); }
 
-void PROOF::addUnit(uint32 unit) { addline(&unit, 1); }
+void PROOF::addUnit(uint32 unit) 
+{ 
+	if (lrat_en) {
+		assert(chain.size());
+		units[vars[ABS(unit)]] = ++nextid;
+		lratline(nextid, &unit, 1);
+	}
+	else addline(&unit, 1); 
+}
 
-void PROOF::addClause(Lits_t& c) { addline(c, c.size()); }
+void PROOF::addClause(Lits_t& c) 
+{ 
+	if (lrat_en) lratline(++nextid, c, c.size());
+	else addline(c, c.size()); 
+}
+
+void PROOF::addClause(CLAUSE& c) 
+{ 
+	if (lrat_en) {
+		assert(chain.size());
+		c.set_lratid(++nextid);
+		lratline(nextid, c, c.size());
+	}
+	else addline(c, c.size()); 
+}
+
+void PROOF::addClause(SCLAUSE& c) 
+{ 
+	if (lrat_en) {
+		assert(chain.size());
+		c.set_lratid(++nextid);
+		lratline(nextid, c, c.size());
+	}
+	else addline(c, c.size()); 
+}
+
+void PROOF::renewClause(CLAUSE& c)
+{
+	assert(lrat_en);
+	const uint64 old = c.lratid();
+	addClause(c);
+	lratdelete(old);
+}
 
-void PROOF::addClause(CLAUSE& c) { addline(c, c.size()); }
+void PROOF::renewClause(SCLAUSE& c)
+{
+	assert(lrat_en);
+	const uint64 old = c.lratid();
+	addClause(c);
+	lratdelete(old);
+}
 
-void PROOF::addClause(SCLAUSE& c) { addline(c, c.size()); }
+void PROOF::deleteClause(const uint64& id) { assert(lrat_en); lratdelete(id); }
 
-void PROOF::deleteClause(Lits_t& c) { delline(c, c.size()); }
+void PROOF::deleteClause(Lits_t& c) { if (!lrat_en) delline(c, c.size()); }
 
-void PROOF::deleteClause(CLAUSE& c) { delline(c, c.size()); }
+void PROOF::deleteClause(CLAUSE& c) 
+{ 
+	if (lrat_en) lratdelete(c.lratid());
+	else delline(c, c.size()); 
+}
 
-void PROOF::deleteClause(SCLAUSE& c) { delline(c, c.size()); }
+void PROOF::deleteClause(SCLAUSE& c) 
+{ 
+	if (lrat_en) lratdelete(c.lratid());
+	else delline(c, c.size()); 
+}
 
 void PROOF::deleteClause(SCLAUSE& c, const uint32& def, const uint32& other)
 {
@@ -215,6 +373,7 @@ void PROOF::addResolvent(SCLAUSE& c)
 {
 	assert(clause.empty());
 	assert(sp != NULL);
+	if (lrat_en) { addClause(c); return; }
 	LIT_ST* values = sp->value;
 	for (int i = 0; i < c.size(); i++) {
 		const uint32 lit = c[i];
@@ -237,6 +396,14 @@ void PROOF::shrinkClause(CLAUSE& c, const uint32& me)
 		if (NEQUAL(lit, me)) clause.push(lit);
 	}
 	assert(clause.size() == c.size() - 1);
+	if (lrat_en) {
+		const uint64 old = c.lratid();
+		c.set_lratid(++nextid);
+		lratline(nextid, clause, clause.size());
+		clause.clear();
+		lratdelete(old);
+		return;
+	}
 	addClause();
 	deleteClause(c);
 }
@@ -250,6 +417,14 @@ void PROOF::shrinkClause(SCLAUSE& c, const uint32& me)
 		if (NEQUAL(lit, me)) clause.push(lit);
 	}
 	assert(clause.size() == c.size() - 1);
+	if (lrat_en) {
+		const uint64 old = c.lratid();
+		c.set_lratid(++nextid);
+		lratline(nextid, clause, clause.size());
+		clause.clear();
+		lratdelete(old);
+		return;
+	}
 	addClause();
 	deleteClause(c);
 }
@@ -258,17 +433,27 @@ void PROOF::shrinkClause(CLAUSE& c)
 {
 	assert(clause.empty());
 	assert(sp != NULL);
-	int* levels = sp->level;
+	LEVELS levels = sp->level;
 	for (int i = 0; i < c.size(); i++) {
 		const uint32 lit = c[i], v = ABS(lit);
 		CHECKLIT(lit);
 		if (!levels[v]) {
 			assert(!sp->value[lit]);
+			if (lrat_en) hintUnit(lit);
 			continue;
 		}
 		clause.push(lit);
 	}
 	assert(clause.size() > 1);
+	if (lrat_en) {
+		const uint64 old = c.lratid();
+		hint(old);
+		c.set_lratid(++nextid);
+		lratline(nextid, clause, clause.size());
+		clause.clear();
+		lratdelete(old);
+		return;
+	}
 	addClause();
 	deleteClause(c);
 }
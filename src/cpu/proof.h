@@ -25,20 +25,29 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "simptypes.h"
 #include "logging.h"
 #include "space.h"
+#include "proofwriter.h"
 
 namespace ParaFROST {
 
 	class PROOF {
 
-		FILE* proofFile;
+		PROOFWRITER	writer;
 		SP*		sp;
 		uint32*	vars;
 		Lits_t	clause, tmpclause;
+		// LRAT ids of root units indexed by original variables
+		// and the hints of the next added clause
+		Vec<uint64> units, chain;
+		uint64	nextid, inputs, hints;
 		size_t	added;
-		bool	nonbinary_en;
+		bool	nonbinary_en, lrat_en;
 
 		inline void		write		(const Byte&);
 		inline void		write		(const uint32*, const int&);
+		inline void		number		(uint64);
+		inline void		varint		(uint64);
+		inline void		lratline	(const uint64&, const uint32*, const int&);
+		inline void		lratdelete	(const uint64&);
 		inline void		binary		(const uint32*, const int&);
 		inline void		nonbinary	(const uint32*, const int&);
 		inline void		addline		(const uint32*, const int&);
@@ -55,10 +64,24 @@ namespace ParaFROST {
 		~PROOF	();
 
 		size_t numClauses		() const { return added; }
+		uint64 numBytes			() const { return writer.written(); }
+		uint64 numStalls		() const { return writer.waits(); }
+		uint64 numHints			() const { return hints; }
+		bool   lrat				() const { return lrat_en; }
+		void hint				(const uint64& id) { assert(id); chain.push(id); }
+		void clearHints			() { chain.clear(); }
+		bool noHints			() const { return chain.empty(); }
 		void close				();
 		void init				(SP*);
 		void init				(SP*, uint32*);
-		void handFile			(arg_t path, const bool&);
+		void initLRAT			(const uint32& orgvars, const uint64& orgclauses);
+		void handFile			(arg_t path, const bool&, const bool&, const size_t& blocksize, const int& queue, const int& level);
+		uint64 original			();
+		void hintUnit			(const uint32&);
+		void refuteUnit			(const uint32&);
+		void renewClause		(CLAUSE&);
+		void renewClause		(SCLAUSE&);
+		void deleteClause		(const uint64&);
 		void checkInput			(arg_t input);
 		void addEmpty			();
 		void addUnit			(uint32);
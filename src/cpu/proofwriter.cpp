@@ -0,0 +1,269 @@
+/***********************************************************************[proofwriter.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "proofwriter.h"
+#include <cerrno>
+
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+#if defined(HAVE_ZSTD)
+#include <zstd.h>
+#endif
+
+using namespace ParaFROST;
+
+// compressed bytes written at once by the encoder
+#define ENCODE_OUTPUT (1ULL << 18)
+
+PROOFWRITER::PROOFWRITER() :
+	blocks(NULL)
+	, current(NULL)
+	, limit(NULL)
+	, output(NULL)
+	, encoder(NULL)
+	, file(NULL)
+	, bytes(0)
+	, stalls(0)
+	, capacity(0)
+	, codec(NOCODEC)
+	, nblocks(0)
+	, head(0)
+	, tail(0)
+	, count(0)
+	, async(false)
+	, stopped(false)
+	, failed(false)
+	{}
+
+PROOFWRITER::~PROOFWRITER() { close(); }
+
+bool PROOFWRITER::open(const char* path, const size_t& blocksize, const int& queue, const CODEC& _codec, const int& level)
+{
+	assert(file == NULL);
+	assert(blocksize);
+	assert(queue > 0);
+	assert(_codec == NOCODEC || codecEncodes(_codec));
+	file = fopen(path, "w");
+	if (file == NULL) return false;
+	codec = _codec;
+	if (codec != NOCODEC && !openEncoder(level)) {
+		std::free(output);
+		output = NULL;
+		fclose(file);
+		file = NULL;
+		return false;
+	}
+	capacity = blocksize;
+	nblocks = queue;
+	async = queue > 1;
+	head = tail = count = 0;
+	stopped = failed = false;
+	blocks = pfmalloc<BLOCK>(nblocks);
+	for (int i = 0; i < nblocks; i++) {
+		blocks[i].data = pfmalloc<Byte>(capacity);
+		blocks[i].size = 0;
+	}
+	current = blocks[0].data;
+	limit = current + capacity;
+	if (async) worker = std::thread(&PROOFWRITER::drain, this);
+	return true;
+}
+
+bool PROOFWRITER::writeAll(const Byte* data, size_t n)
+{
+#if defined(__linux__) || defined(__CYGWIN__)
+	const int fd = fileno(file);
+	while (n) {
+		const ssize_t w = ::write(fd, data, n);
+		if (w < 0) {
+			if (errno == EINTR) continue;
+			return false;
+		}
+		data += w, n -= w;
+	}
+	return true;
+#else
+	return fwrite(data, 1, n, file) == n;
+#endif
+}
+
+bool PROOFWRITER::openEncoder(const int& level)
+{
+	assert(encoder == NULL);
+	output = pfmalloc<Byte>(ENCODE_OUTPUT);
+#if defined(HAVE_ZLIB)
+	if (codec == GZIP) {
+		z_stream* strm = new z_stream();
+		// a window of 15 bits plus 16 selects the gzip wrapper
+		if (deflateInit2(strm, level ? MIN(level, 9) : Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+			delete strm;
+			return false;
+		}
+		encoder = strm;
+	}
+#endif
+#if defined(HAVE_ZSTD)
+	if (codec == ZSTD) {
+		ZSTD_CCtx* strm = ZSTD_createCCtx();
+		if (strm == NULL) return false;
+		const int maxlevel = ZSTD_maxCLevel();
+		ZSTD_CCtx_setParameter(strm, ZSTD_c_compressionLevel, level ? MIN(level, maxlevel) : ZSTD_CLEVEL_DEFAULT);
+		encoder = strm;
+	}
+#endif
+	return encoder != NULL;
+}
+
+void PROOFWRITER::closeEncoder()
+{
+#if defined(HAVE_ZLIB)
+	if (codec == GZIP) {
+		z_stream* strm = (z_stream*)encoder;
+		deflateEnd(strm);
+		delete strm;
+	}
+#endif
+#if defined(HAVE_ZSTD)
+	if (codec == ZSTD) ZSTD_freeCCtx((ZSTD_CCtx*)encoder);
+#endif
+	encoder = NULL;
+	std::free(output);
+	output = NULL;
+}
+
+bool PROOFWRITER::deflateAll(const Byte* data, const size_t& n, const bool& finish)
+{
+#if defined(HAVE_ZLIB)
+	z_stream* strm = (z_stream*)encoder;
+	strm->next_in = (Bytef*)data;
+	strm->avail_in = uInt(n);
+	// deflate until it leaves room in the output, then all input is consumed
+	do {
+		strm->next_out = output;
+		strm->avail_out = uInt(ENCODE_OUTPUT);
+		if (deflate(strm, finish ? Z_FINISH : Z_NO_FLUSH) == Z_STREAM_ERROR) return false;
+		const size_t have = ENCODE_OUTPUT - strm->avail_out;
+		if (have && !writeAll(output, have)) return false;
+	} while (!strm->avail_out);
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool PROOFWRITER::zstdAll(const Byte* data, const size_t& n, const bool& finish)
+{
+#if defined(HAVE_ZSTD)
+	ZSTD_CCtx* strm = (ZSTD_CCtx*)encoder;
+	ZSTD_inBuffer src = { data, n, 0 };
+	size_t left = 0;
+	do {
+		ZSTD_outBuffer dst = { output, ENCODE_OUTPUT, 0 };
+		left = ZSTD_compressStream2(strm, &dst, &src, finish ? ZSTD_e_end : ZSTD_e_continue);
+		if (ZSTD_isError(left)) return false;
+		if (dst.pos && !writeAll(output, dst.pos)) return false;
+	} while (finish ? left != 0 : src.pos < src.size);
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool PROOFWRITER::emit(const Byte* data, const size_t& n, const bool& finish)
+{
+	switch (codec) {
+	case GZIP: return deflateAll(data, n, finish);
+	case ZSTD: return zstdAll(data, n, finish);
+	default: return writeAll(data, n);
+	}
+}
+
+void PROOFWRITER::flush()
+{
+	assert(file != NULL);
+	BLOCK& block = blocks[tail];
+	block.size = current - block.data;
+	if (!block.size) return;
+	bytes += block.size;
+	if (!async) {
+		if (!emit(block.data, block.size, false)) PFLOGE("cannot write proof file");
+		current = block.data;
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		tail = (tail + 1) % nblocks;
+		count++;
+	}
+	filled.notify_one();
+	{
+		// the next block is free once the worker is no longer behind by all of them
+		std::unique_lock<std::mutex> guard(lock);
+		if (count == nblocks) stalls++;
+		drained.wait(guard, [this] { return count < nblocks; });
+		if (failed) PFLOGE("cannot write proof file");
+	}
+	current = blocks[tail].data;
+	limit = current + capacity;
+}
+
+void PROOFWRITER::drain()
+{
+	bool ok = true;
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		filled.wait(guard, [this] { return count > 0 || stopped; });
+		if (!count) break;
+		// the head block is not touched by the solver while it is counted
+		const BLOCK& block = blocks[head];
+		guard.unlock();
+		if (ok) ok = emit(block.data, block.size, false);
+		guard.lock();
+		if (!ok) failed = true;
+		head = (head + 1) % nblocks;
+		count--;
+		drained.notify_one();
+	}
+}
+
+void PROOFWRITER::close()
+{
+	if (file == NULL) return;
+	flush();
+	if (async) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopped = true;
+		}
+		filled.notify_all();
+		worker.join();
+		if (failed) PFLOGE("cannot write proof file");
+	}
+	if (codec != NOCODEC) {
+		if (!emit(NULL, 0, true)) PFLOGE("cannot write proof file");
+		closeEncoder();
+	}
+	fclose(file);
+	file = NULL;
+	for (int i = 0; i < nblocks; i++)
+		std::free(blocks[i].data);
+	std::free(blocks);
+	blocks = NULL;
+	current = limit = NULL;
+}
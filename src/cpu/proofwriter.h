@@ -0,0 +1,76 @@
+/***********************************************************************[proofwriter.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __PROOF_WRITER_
+#define __PROOF_WRITER_
+
+#include "decompress.h"
+#include "malloc.h"
+
+namespace ParaFROST {
+
+	/*****************************************************/
+	/*  Usage:   buffers proof bytes and writes full     */
+	/*           buffers on its own thread through a     */
+	/*           bounded ring; the solver waits only if  */
+	/*           all buffers are queued; gzip and zstd   */
+	/*           files are compressed by the same thread */
+	/*  Dependency:  CODEC                               */
+	/*****************************************************/
+	class PROOFWRITER {
+		struct BLOCK { Byte* data; size_t size; };
+		BLOCK*		blocks;
+		Byte*		current, * limit;
+		Byte*		output;
+		void*		encoder;
+		FILE*		file;
+		std::thread	worker;
+		std::mutex	lock;
+		std::condition_variable	filled, drained;
+		uint64		bytes, stalls;
+		size_t		capacity;
+		CODEC		codec;
+		int			nblocks, head, tail, count;
+		bool		async, stopped, failed;
+
+		// called by the worker
+		void	drain		();
+		bool	writeAll	(const Byte* data, size_t n);
+		bool	emit		(const Byte* data, const size_t& n, const bool& finish);
+		bool	deflateAll	(const Byte* data, const size_t& n, const bool& finish);
+		bool	zstdAll		(const Byte* data, const size_t& n, const bool& finish);
+		bool	openEncoder	(const int& level);
+		void	closeEncoder();
+
+	public:
+				PROOFWRITER	();
+				~PROOFWRITER();
+		// 'queue' blocks of 'blocksize' bytes; a queue of 1 writes on the caller
+		// 'codec' must have an encoder; a 'level' of 0 is the codec default
+		bool	open		(const char* path, const size_t& blocksize, const int& queue, const CODEC& codec, const int& level);
+		void	flush		();
+		void	close		();
+		inline	void	put			(const Byte& byte) { if (current == limit) flush(); *current++ = byte; }
+		inline	bool	opened		() const { return file != NULL; }
+		inline	uint64	written		() const { return file == NULL ? bytes : bytes + uint64(current - blocks[tail].data); }
+		inline	uint64	waits		() const { return stalls; }
+	};
+
+}
+
+#endif
@@ -64,6 +64,8 @@ namespace ParaFROST {
 				RADIXBUFFER[m]++;
 			}
 			if (lower == upper) break;
+			// all elements share this digit
+			if (RADIXBUFFER[lower & RADIXMASK] == n) continue;
 			size_t pos = 0;
 			for (size_t j = 0; j < RADIXWIDTH; ++j) {
 				size_t delta = RADIXBUFFER[j];
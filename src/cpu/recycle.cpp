@@ -26,47 +26,92 @@ inline void Solver::moveClause(C_REF& r, CMM& newBlock)
 	assert(!c.deleted());
 	if (c.moved()) { r = c.ref(); return; }
 	r = newBlock.alloc(c);
+	if (newBlock.storesIds()) newBlock[r].set_lratid(c.lratid());
 	c.set_ref(r);
 }
 
 inline void	Solver::moveWatches(WL& ws, CMM& new_cm)
 {
 	forall_watches(ws, w) {
-		moveClause(w->ref, new_cm);
+		C_REF r = w->ref();
+		moveClause(r, new_cm);
+		w->set_ref(r);
 	}
 	ws.shrinkCap();
 }
 
+inline void	Solver::moveWatches(BL& bs, CMM& new_cm)
+{
+	forall_bwatches(bs, w) {
+		C_REF r = w->ref();
+		moveClause(r, new_cm);
+		w->set_ref(r);
+	}
+	bs.shrinkCap();
+}
+
+inline void	Solver::forwardWatches(WL& ws)
+{
+	forall_watches(ws, w) {
+		w->set_ref(cm[w->ref()].ref());
+	}
+	ws.shrinkCap();
+}
+
+inline void	Solver::forwardWatches(BL& bs)
+{
+	forall_bwatches(bs, w) {
+		w->set_ref(cm[w->ref()].ref());
+	}
+	bs.shrinkCap();
+}
+
 inline void	Solver::recycleWL(const uint32& lit)
 {
 	CHECKLIT(lit);
-	WL& ws = wt[lit], hypers;
-	if (ws.empty()) return;
+	BL& bs = bt[lit], hypers;
+	WL& ws = wt[lit];
+	if (bs.empty() && ws.empty()) return;
 	const uint32 flit = FLIP(lit);
-	WATCH *j = ws;
+	BWATCH* k = bs;
+	forall_bwatches(bs, i) {
+		const BWATCH w = *i;
+		const C_REF r = w.ref();
+		assert(r != NOREF);
+		if (cm.deleted(r)) continue;
+		const CLAUSE& c = cm[r];
+		assert(c.binary());
+		if (w.learnt() && meta(c).hyper()) hypers.push(w);
+		else *k++ = w;
+	}
+	bs.resize(int(k - bs));
+	WATCH* j = ws;
 	forall_watches(ws, i) {
 		WATCH w = *i;
-		const C_REF r = w.ref;
+		const C_REF r = w.ref();
 		assert(r != NOREF);
 		if (cm.deleted(r)) continue;
 		CLAUSE& c = cm[r];
-		w.imp = c[0] ^ c[1] ^ flit;
-		w.size = c.size();
-		if (c.binary()) {
-			if (c.hyper()) hypers.push(w);
-			else *j++ = w;
+		const uint32 imp = c[0] ^ c[1] ^ flit;
+		if (c.binary()) { // shrunken to a binary
+			const BWATCH b(r, c.learnt(), imp);
+			if (c.learnt() && meta(c).hyper()) hypers.push(b);
+			else bs.push(b);
+		}
+		else if (c.original()) {
+			w.imp = imp;
+			*j++ = w;
 		}
-		else if (c.original()) *j++ = w;
 	}
 	ws.resize(int(j - ws));
-	forall_watches(hypers, i) ws.push(*i);
+	forall_bwatches(hypers, i) bs.push(*i);
 	hypers.clear(true);
 }
 
 void Solver::markReasons() 
 {
-	const VSTATE* states = sp->vstate;
-	const C_REF* sources = sp->source;
+	CVSTATES states = sp->vstate;
+	CSOURCES sources = sp->source;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		if (states[v].state) continue;
@@ -74,16 +119,19 @@ void Solver::markReasons()
 		assert(sp->level[v]);
 		const C_REF r = sources[v];
 		if (REASON(r)) {
-			assert(!cm[r].reason());
-			cm[r].markReason();
+			const CLAUSE& c = cm[r];
+			if (c.original()) continue;
+			LMETA& m = meta(c);
+			assert(!m.reason());
+			m.markReason();
 		}
 	}
 }
 
 void Solver::unmarkReasons() 
 {
-	const VSTATE* states = sp->vstate;
-	const C_REF* sources = sp->source;
+	CVSTATES states = sp->vstate;
+	CSOURCES sources = sp->source;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		if (states[v].state) continue;
@@ -91,8 +139,11 @@ void Solver::unmarkReasons()
 		assert(sp->level[v]);
 		const C_REF r = sources[v];
 		if (REASON(r)) {
-			assert(cm[r].reason());
-			cm[r].initReason();
+			const CLAUSE& c = cm[r];
+			if (c.original()) continue;
+			LMETA& m = meta(c);
+			assert(m.reason());
+			m.initReason();
 		}
 	}
 }
@@ -112,6 +163,8 @@ void Solver::recycleWT()
 		sortClause(c);
 		attachWatch(r, c);
 	}
+	bt.compact();
+	wt.compact();
 }
 
 void Solver::recycle(CMM& new_cm)
@@ -121,11 +174,13 @@ void Solver::recycle(CMM& new_cm)
 	recycleWT();
 	for (uint32 q = vmtf.last(); q; q = vmtf.previous(q)) {
 		const uint32 lit = makeAssign(q), flit = FLIP(lit);
+		moveWatches(bt[lit], new_cm);
+		moveWatches(bt[flit], new_cm);
 		moveWatches(wt[lit], new_cm);
 		moveWatches(wt[flit], new_cm);
 	}
-	C_REF* sources = sp->source;
-	int* levels = sp->level;
+	SOURCES sources = sp->source;
+	LEVELS levels = sp->level;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		C_REF& r = sources[v];
@@ -143,6 +198,96 @@ void Solver::recycle(CMM& new_cm)
 	orgs.shrinkCap();
 }
 
+void Solver::compact()
+{
+	reduced.clear(true);
+	analyzed.clear(true);
+	recycleWT();
+	filter(orgs);
+	filter(learnts);
+	// schedule live clauses in memory order so sliding
+	// them down never overwrites an unvisited clause
+	BCNF live;
+	live.reserve(orgs.size() + learnts.size());
+	forall_cnf(orgs, i) { live.push(*i); }
+	forall_cnf(learnts, i) { live.push(*i); }
+	rSort(live.data(), live.size());
+	// forwarding references overlap the first two literals,
+	// so save them before marking clauses as moved
+	Vec<uint32, C_REF> heads;
+	heads.reserve(C_REF(live.size()) << 1);
+	// a stored LRAT id moves along in front of its clause
+	const size_t lead = cm.lead();
+	C_REF dest = 0;
+	forall_cnf(live, i) {
+		CLAUSE& c = cm[*i];
+		assert(!c.deleted());
+		assert(!c.moved());
+		heads.insert(c[0]), heads.insert(c[1]);
+		const size_t bytes = cm.bytes(c.size());
+		c.set_ref(dest + lead);
+		dest += bytes;
+	}
+	assert(dest <= cm.size());
+	// forward references
+	forall_literal(lit) {
+		forwardWatches(bt[lit]);
+		forwardWatches(wt[lit]);
+	}
+	SOURCES sources = sp->source;
+	LEVELS levels = sp->level;
+	forall_vector(uint32, trail, t) {
+		const uint32 lit = *t, v = ABS(lit);
+		C_REF& r = sources[v];
+		if (REASON(r)) {
+			if (levels[v]) {
+				assert(r < cm.size());
+				if (cm.deleted(r)) r = NOREF;
+				else r = cm[r].ref();
+			}
+			else r = NOREF;
+		}
+	}
+	forall_cnf(orgs, i) { *i = cm[*i].ref(); }
+	forall_cnf(learnts, i) { *i = cm[*i].ref(); }
+	orgs.shrinkCap();
+	// slide clauses down
+	const uint32* h = heads;
+	forall_cnf(live, i) {
+		const C_REF r = *i;
+		CLAUSE& c = cm[r];
+		const C_REF to = c.ref();
+		assert(to <= r);
+		if (to < r) std::memmove(cm.address(to - lead), cm.address(r - lead), cm.bytes(c.size()));
+		CLAUSE& moved = cm[to];
+		moved.initMoved();
+		moved[0] = *h++;
+		moved[1] = *h++;
+	}
+	live.clear(true);
+	heads.clear(true);
+	cm.compactTo(dest);
+}
+
+void Solver::compactMeta()
+{
+	// 'learnts' holds exactly the live learnt clauses 
+	// after filtering, so renumber their metadata in order
+	LMETAS live;
+	live.reserve(learnts.size());
+	forall_cnf(learnts, i) {
+		const C_REF r = *i;
+		CLAUSE& c = cm[r];
+		assert(c.learnt());
+		assert(!c.deleted());
+		LMETA m = meta(c);
+		m.set_ref(r);
+		c.set_id(live.size());
+		live.insert(m);
+	}
+	live.migrateTo(lmeta);
+}
+
 void Solver::recycle() 
 {
 	assert(sp->propagated == trail.size());
@@ -153,11 +298,18 @@ void Solver::recycle()
 		PFLOGN2(2, " Recycling garbage..");
 		stats.recycle.hard++;
 		assert(cm.size() >= cm.garbage());
-		const size_t bytes = cm.size() - cm.garbage();
-		CMM new_cm(bytes);
-		recycle(new_cm);
-		PFLGCMEM(2, cm, new_cm);
-		new_cm.migrateTo(cm);
+		if (opts.gc_inplace_en) {
+			const C_REF oldsize = cm.size();
+			compact();
+			PFLGCSIZE(2, oldsize, cm);
+		}
+		else {
+			const size_t bytes = cm.size() - cm.garbage();
+			CMM new_cm(bytes, cm.storesIds());
+			recycle(new_cm);
+			PFLGCMEM(2, cm, new_cm);
+			new_cm.migrateTo(cm);
+		}
 		PFLDONE(2, 5);
 	}
 	else {
@@ -165,6 +317,7 @@ void Solver::recycle()
 		recycleWT();
 		filter(learnts);
 	}
+	compactMeta();
 }
 
 void Solver::filter(BCNF& cnf) 
@@ -19,15 +19,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "solver.h"
 using namespace ParaFROST;
 
-struct LEARNT_CMP {
-	const CMM& cm;
-	LEARNT_CMP(const CMM& _cm) : cm(_cm) {}
-	bool operator () (const C_REF& a, const C_REF& b) const {
-		const CLAUSE& x = cm[a], & y = cm[b];
-		const int xl = x.lbd(), yl = y.lbd();
-		if (xl > yl) return true;
-		if (xl < yl) return false;
-		return x.size() > y.size();
+// larger lbd first, then larger size (radix sort is stable)
+struct LEARNT_RANK {
+	uint64 operator () (const LKEY& a) const { 
+		return (uint64(~a.lbd) << 32) | uint64(~a.size);
 	}
 };
 
@@ -58,7 +53,10 @@ void Solver::reduce()
 	const bool shrunken = shrink();
 	if (learnts.empty()) return;
 	markReasons();
+	// garbage collection is not part of the reduce time
+	timer.pstart();
 	reduceLearnts();
+	timer.pstop(), timer.reduce += timer.pcpuTime();
 	recycle();
 	unmarkReasons();
 	INCREASE_LIMIT(reduce, stats.reduces, nbylogn, false);
@@ -67,21 +65,22 @@ void Solver::reduce()
 
 void Solver::reduceLearnts()
 {
-	assert(reduced.empty());
+	assert(reducible.empty());
 	assert(learnts.size());
-	reduced.reserve(learnts.size());
-	C_REF* end = learnts.end();
-	for (C_REF* i = learnts; i != end; i++) {
-		const C_REF r = *i;
-		if (cm.deleted(r)) continue;
-		CLAUSE& c = cm[r];
-		assert(!c.deleted());
-		assert(c.learnt());
-		if (c.reason()) continue;
-		if (c.hyper()) {
-			assert(c.size() <= 3);
-			if (c.usage()) c.warm();
+	reducible.reserve(learnts.size());
+	// scan the dense metadata table; clauses are
+	// only touched when they are about to be removed
+	forall_vector(LMETA, lmeta, m) {
+		if (m->dead() || m->reason()) continue;
+		const C_REF r = m->ref();
+		assert(!cm.deleted(r));
+		assert(cm[r].learnt());
+		assert(cm[r].id() == uint32(m - lmeta.data()));
+		if (m->hyper()) {
+			if (m->usage()) m->warm();
 			else {
+				CLAUSE& c = cm[r];
+				assert(c.size() <= 3);
 				removeClause(c, r);
 #ifdef STATISTICS
 				if (c.binary()) stats.binary.reduced++;
@@ -90,39 +89,41 @@ void Solver::reduceLearnts()
 			}
 			continue;
 		}
-		if (c.keep()) continue;
-		if (c.usage()) {
-			c.warm();
-			if (c.lbd() <= opts.lbd_tier2) continue;
+		if (m->keep()) continue;
+		if (m->usage()) {
+			m->warm();
+			if (m->lbd() <= opts.lbd_tier2) continue;
 		}
-		assert(c.size() > 2);
-		reduced.push(r);
+		const int size = cm[r].size();
+		assert(size > 2);
+		reducible.push(LKEY(r, m->lbd(), size));
 	}
-	const C_REF rsize = reduced.size();
+	const uint32 rsize = reducible.size();
 	if (rsize) {
-		C_REF pivot = opts.reduce_perc * rsize;
-		PFLOGN2(2, " Reducing learnt database up to (%zd clauses)..", pivot);
-		end = reduced.end();
-		C_REF* head = reduced.data();
-		std::stable_sort(head, end, LEARNT_CMP(cm));
+		const uint32 pivot = opts.reduce_perc * rsize;
+		PFLOGN2(2, " Reducing learnt database up to (%d clauses)..", pivot);
+		LKEY* end = reducible.end();
+		LKEY* head = reducible.data();
+		radixSort(head, end, LEARNT_RANK());
 		// remove unlucky learnts from database
-		C_REF *tail = reduced + pivot;
+		LKEY* tail = head + pivot;
 		for (; head != tail; head++) {
-			const C_REF r = *head;
-			assert(cm[r].learnt());
-			assert(!cm[r].reason());
-			assert(!cm[r].keep());
-			assert(cm[r].lbd() > opts.lbd_tier1);
-			assert(cm[r].size() > 2);
-			removeClause(cm[r], r);
+			const C_REF r = head->ref;
+			CLAUSE& c = cm[r];
+			assert(c.learnt());
+			assert(!meta(c).reason());
+			assert(!meta(c).keep());
+			assert(meta(c).lbd() > opts.lbd_tier1);
+			assert(c.size() > 2);
+			removeClause(c, r);
 		}
-		limit.keptsize = 0, limit.keptlbd = 0;
+		uint32 keptlbd = 0, keptsize = 0;
 		for (head = tail; head != end; head++) {
-			const CLAUSE& c = cm[*head];
-			if (c.lbd() > limit.keptlbd) limit.keptlbd = c.lbd();
-			if (c.size() > limit.keptsize) limit.keptsize = c.size();
+			if (head->lbd > keptlbd) keptlbd = head->lbd;
+			if (head->size > keptsize) keptsize = head->size;
 		}
-		reduced.clear();
+		limit.keptlbd = keptlbd, limit.keptsize = keptsize;
 		PFLENDING(2, 5, "(kept lbd: %d, size: %d)", limit.keptlbd, limit.keptsize);
 	}
+	reducible.clear(true);
 }
\ No newline at end of file
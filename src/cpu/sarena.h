@@ -0,0 +1,101 @@
+/***********************************************************************[sarena.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SARENA_
+#define __SARENA_
+
+#include "vector.h"
+#include "sclause.h"
+
+namespace ParaFROST {
+
+	// arena words are 8 bytes to keep the clause ids aligned
+	typedef uint64 SWORD;
+
+	constexpr size_t	SARENAMINCHUNK	= (1ULL << 16);
+
+	/*****************************************************/
+	/*  Usage:   bump-pointer memory of SCLAUSEs grown   */
+	/*           in chunks that never move until they    */
+	/*           are compacted or released at once       */
+	/*  Dependency:  SCLAUSE                             */
+	/*****************************************************/
+	class SARENA {
+		Vec<SWORD*>	chunks;
+		SWORD		*top, *limit;
+		size_t		lead; // words of the LRAT id preceding every clause
+
+		inline	void	newChunk	(const size_t& n) {
+			// the leftover of the current chunk is reclaimed by compaction
+			const size_t last = limit - (chunks.empty() ? limit : chunks.back());
+			size_t words = MAX(last >> 1, SARENAMINCHUNK);
+			if (words < n) words = n;
+			SWORD* chunk = pfmalloc<SWORD>(words);
+			chunks.push(chunk);
+			top = chunk, limit = chunk + words;
+		}
+	public:
+				SARENA		() : top(NULL), limit(NULL), lead(0) {}
+				~SARENA		() { destroy(); }
+		inline	void	storeIds	(const bool& ids) { assert(chunks.empty()); lead = ids; }
+		// words taken by a clause of 'size' literals
+		inline	size_t	words		(const int& size) const {
+			assert(size > 0);
+			return lead + (hc_scsize + (size - 1) * hc_isize + sizeof(SWORD) - 1) / sizeof(SWORD);
+		}
+		// first chunk holding 'nCls' clauses of 'nLits' literals in total
+		inline	void	init		(const size_t& nCls, const size_t& nLits) {
+			destroy();
+			newChunk(nCls * words(1) + (nLits * hc_isize + sizeof(SWORD) - 1) / sizeof(SWORD));
+		}
+		inline	S_REF	alloc		(const int& size) {
+			const size_t n = words(size);
+			if (size_t(limit - top) < n) newChunk(n);
+			SWORD* block = top;
+			top += n;
+			return (S_REF)(block + lead);
+		}
+		// moves the clauses of 'scnf' in order to a single chunk;
+		// deleted clauses must have been dropped from 'scnf' already
+		inline	void	compact		(Vec<S_REF, size_t>& scnf) {
+			size_t live = 0;
+			for (size_t i = 0; i < scnf.size(); i++)
+				live += words(scnf[i]->size());
+			SWORD* chunk = pfmalloc<SWORD>(live ? live : 1);
+			SWORD* t = chunk;
+			for (size_t i = 0; i < scnf.size(); i++) {
+				const size_t n = words(scnf[i]->size());
+				std::memcpy(t, (SWORD*)scnf[i] - lead, n * sizeof(SWORD));
+				scnf[i] = (S_REF)(t + lead);
+				t += n;
+			}
+			assert(size_t(t - chunk) == live);
+			destroy();
+			chunks.push(chunk);
+			top = limit = t;
+		}
+		inline	void	destroy		() {
+			for (uint32 i = 0; i < chunks.size(); i++) std::free(chunks[i]);
+			chunks.clear(true);
+			top = limit = NULL;
+		}
+	};
+
+}
+
+#endif
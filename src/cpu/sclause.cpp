@@ -32,7 +32,7 @@ void Solver::newClause(SCLAUSE& s)
 	if (mapped) vmap.mapClause(new_c, s);
 	else new_c.copyLitsFrom(s);
 	assert(size == new_c.size());
-	assert(new_c.keep());
+	if (opts.lrat_en) new_c.set_lratid(s.lratid());
 	assert(new_c[0] > 1 && new_c[1] > 1);
 	assert(new_c[0] <= NOVAR && new_c[1] <= NOVAR);
 	assert(!new_c.deleted());
@@ -42,10 +42,11 @@ void Solver::newClause(SCLAUSE& s)
 		assert(s.usage() < USAGET1);
 		assert(!s.added());
 		new_c.markLearnt();
+		LMETA& m = attachMeta(r, new_c);
 		int lbd = s.lbd();
-		if (size > 2 && lbd > opts.lbd_tier1) new_c.set_keep(0);
-		new_c.set_lbd(lbd);
-		new_c.set_usage(s.usage());
+		if (size > 2 && lbd > opts.lbd_tier1) m.set_keep(0);
+		m.set_lbd(lbd);
+		m.set_usage(s.usage());
 		learnts.push(r);
 		stats.literals.learnt += size;
 	}
@@ -82,11 +83,3 @@ void Solver::removeClause(SCLAUSE& c)
 			proof.deleteClause(c);
 	}
 }
-
-void Solver::deleteClause(S_REF& c)
-{
-	if (c) {
-		delete c;
-		c = NULL;
-	}
-}
\ No newline at end of file
@@ -27,18 +27,19 @@ namespace ParaFROST {
 	/*  Dependency:  none                                */
 	/*****************************************************/
 	class SCLAUSE {
-		unsigned _st : 2, _f : 1, _a : 1, _u : 2;
-		unsigned _lbd : 26;
+		unsigned _st : 2, _a : 1, _u : 2;
+		unsigned _lbd : 19;
+		Byte _f; // own byte, as BVE workers melt their clauses while others read the status
 		uint32 _sig;
 		int _sz;
 		uint32 _lits[1];
 	public:
 		SCLAUSE		() :
 			_st(ORIGINAL)
-			, _f(0)
 			, _a(0)
 			, _u(0)
 			, _lbd(0)
+			, _f(0)
 			, _sig(0)
 			, _sz(0)
 		{}
@@ -62,11 +63,7 @@ namespace ParaFROST {
 			_a = 0;
 			assert(original() == !src.learnt());
 			assert(!src.deleted());
-			if (learnt()) {
-				_lbd = src.lbd() & MAX_LBD_M;
-				_u = src.usage();
-			}
-			else { _lbd = 0, _u = 0; }
+			_lbd = 0, _u = 0; // learnt metadata is set by the caller
 			copyLitsFrom(src);
 		}
 		template <class SRC>
@@ -81,6 +78,7 @@ namespace ParaFROST {
 		inline void		set_sig		(const uint32& sig) { _sig = sig; }
 		inline void		set_usage	(const CL_ST& usage) { _u = usage; }
 		inline void		set_status	(const CL_ST& status) { _st = status; }
+		inline void		set_lratid	(const uint64& id) { ((uint64*)this)[-1] = id; }
 		inline void		shrink		(const int& n) { _sz -= n; }
 		inline void		resize		(const int& n) { _sz = n; }
 		inline uint32	lit			(const int& i) { assert(i < _sz); return _lits[i]; }
@@ -105,6 +103,8 @@ namespace ParaFROST {
 		inline CL_ST	status		() const { return _st; }
 		inline int		size		() const { return _sz; }
 		inline unsigned	lbd			() const { return _lbd; }
+		// the LRAT id precedes clauses of an 'SARENA' storing ids
+		inline uint64	lratid		() const { return ((const uint64*)this)[-1]; }
 		inline uint32	sig			() { return _sig; }
 		inline int		hasZero		() {
 			for (int i = 0; i < _sz; i++)
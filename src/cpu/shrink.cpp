@@ -23,14 +23,15 @@ void Solver::bumpShrunken(CLAUSE& c)
 {
 	assert(c.learnt());
 	assert(c.size() > 1);
-	if (c.keep()) return;
-	if (c.hyper()) return;
-	int old_lbd = c.lbd();
+	LMETA& m = meta(c);
+	if (m.keep()) return;
+	if (m.hyper()) return;
+	int old_lbd = m.lbd();
 	int new_lbd = MIN(c.size() - 1, old_lbd);
 	if (new_lbd >= old_lbd) return;
-	if (new_lbd <= opts.lbd_tier1) c.set_keep(1);
-	else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) c.initTier2();
-	c.set_lbd(new_lbd);
+	if (new_lbd <= opts.lbd_tier1) m.set_keep(1);
+	else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) m.initTier2();
+	m.set_lbd(new_lbd);
 	PFLCLAUSE(4, c, " Bumping shrunken clause with LBD %d ", new_lbd);
 }
 
@@ -54,7 +55,7 @@ CL_ST Solver::rooted(CLAUSE& c)
 {
 	assert(!c.deleted());
 	CL_ST st = UNDEFINED;
-	const int* levels = sp->level;
+	const LEVELS levels = sp->level;
 	const LIT_ST* values = sp->value;
 	forall_clause(c, k) {
 		const uint32 lit = *k;
@@ -71,7 +72,7 @@ CL_ST Solver::rooted(CLAUSE& c)
 
 int Solver::removeRooted(CLAUSE& c)
 {
-	const int* levels = sp->level;
+	const LEVELS levels = sp->level;
 	uint32* j = c;
 	forall_clause(c, i) {
 		const uint32 lit = *i;
@@ -206,6 +207,7 @@ void Solver::shrinkTop(BCNF& cnf)
 		CL_ST st = rootedTop(c);
 		if (st > 0) removeClause(c, r);
 		else if (!st) {
+			if (opts.lrat_en) proof.shrinkClause(c);
 			shrinkClause(c, removeRooted(c));
 			*j++ = r;
 		}
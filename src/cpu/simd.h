@@ -0,0 +1,137 @@
+/***********************************************************************[simd.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SIMD_
+#define __SIMD_
+
+#include "datatypes.h"
+#include <cassert>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_AVX2 1
+#endif
+
+namespace ParaFROST {
+
+	// Returns the first literal in [k, end) that is not falsified
+	// under 'values', or 'end' if all literals are falsified
+	inline uint32* scalarNonFalse(const LIT_ST* values, uint32* k, uint32* end)
+	{
+		while (k != end && !values[*k]) k++;
+		return k;
+	}
+
+#if defined(SIMD_AVX2)
+	// Same as 'scalarNonFalse' but gathers the values of 8 literals at once.
+	// Each gather reads 4 bytes at 'values + lit', so up to 3 bytes past the
+	// last literal value are touched; 'SP' keeps more 1-byte arrays after
+	// 'value', hence these reads never leave the allocated block
+	__attribute__((target("avx2")))
+	inline uint32* avx2NonFalse(const LIT_ST* values, uint32* k, uint32* end)
+	{
+		const __m256i lowbyte = _mm256_set1_epi32(0xFF);
+		const __m256i zero = _mm256_setzero_si256();
+		while (end - k >= 8) {
+			const __m256i lits = _mm256_loadu_si256((const __m256i*)k);
+			const __m256i vals = _mm256_and_si256(_mm256_i32gather_epi32((const int*)values, lits, 1), lowbyte);
+			const int falsified = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(vals, zero)));
+			if (falsified != 0xFF) return k + __builtin_ctz(~falsified & 0xFF);
+			k += 8;
+		}
+		return scalarNonFalse(values, k, end);
+	}
+#endif
+
+	// bytes classified at once by the DIMACS tokenizer
+	constexpr int TOKEN_BLOCK = 64;
+
+	// sets bit 'i' of 'digits', 'spaces' and 'signs' if byte 'i' of 'block'
+	// is a decimal digit, a white space, or a '-'/'+' respectively
+	typedef void (*CLASSIFIER)(const char* block, uint64& digits, uint64& spaces, uint64& signs);
+
+#if defined(SIMD_AVX2)
+	inline void sse2Classify(const char* block, uint64& digits, uint64& spaces, uint64& signs)
+	{
+		const __m128i zero = _mm_set1_epi8('0'), nine = _mm_set1_epi8(9);
+		const __m128i tab = _mm_set1_epi8(9), cr = _mm_set1_epi8(13 - 9), blank = _mm_set1_epi8(' ');
+		const __m128i minus = _mm_set1_epi8('-'), plus = _mm_set1_epi8('+');
+		uint64 d = 0, w = 0, g = 0;
+		for (int q = 0; q < TOKEN_BLOCK; q += 16) {
+			const __m128i b = _mm_loadu_si128((const __m128i*)(block + q));
+			const __m128i x = _mm_sub_epi8(b, zero);
+			const __m128i isdigit = _mm_cmpeq_epi8(_mm_min_epu8(x, nine), x);
+			const __m128i y = _mm_sub_epi8(b, tab);
+			const __m128i isspace = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(y, cr), y), _mm_cmpeq_epi8(b, blank));
+			const __m128i issign = _mm_or_si128(_mm_cmpeq_epi8(b, minus), _mm_cmpeq_epi8(b, plus));
+			d |= uint64(uint32(_mm_movemask_epi8(isdigit))) << q;
+			w |= uint64(uint32(_mm_movemask_epi8(isspace))) << q;
+			g |= uint64(uint32(_mm_movemask_epi8(issign))) << q;
+		}
+		digits = d, spaces = w, signs = g;
+	}
+
+	__attribute__((target("avx2")))
+	inline void avx2Classify(const char* block, uint64& digits, uint64& spaces, uint64& signs)
+	{
+		const __m256i zero = _mm256_set1_epi8('0'), nine = _mm256_set1_epi8(9);
+		const __m256i tab = _mm256_set1_epi8(9), cr = _mm256_set1_epi8(13 - 9), blank = _mm256_set1_epi8(' ');
+		const __m256i minus = _mm256_set1_epi8('-'), plus = _mm256_set1_epi8('+');
+		uint64 d = 0, w = 0, g = 0;
+		for (int q = 0; q < TOKEN_BLOCK; q += 32) {
+			const __m256i b = _mm256_loadu_si256((const __m256i*)(block + q));
+			const __m256i x = _mm256_sub_epi8(b, zero);
+			const __m256i isdigit = _mm256_cmpeq_epi8(_mm256_min_epu8(x, nine), x);
+			const __m256i y = _mm256_sub_epi8(b, tab);
+			const __m256i isspace = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(y, cr), y), _mm256_cmpeq_epi8(b, blank));
+			const __m256i issign = _mm256_or_si256(_mm256_cmpeq_epi8(b, minus), _mm256_cmpeq_epi8(b, plus));
+			d |= uint64(uint32(_mm256_movemask_epi8(isdigit))) << q;
+			w |= uint64(uint32(_mm256_movemask_epi8(isspace))) << q;
+			g |= uint64(uint32(_mm256_movemask_epi8(issign))) << q;
+		}
+		digits = d, spaces = w, signs = g;
+	}
+#endif
+
+	// the widest classifier available, or NULL to tokenize byte by byte
+	inline CLASSIFIER pickClassifier(const bool& avx2)
+	{
+#if defined(SIMD_AVX2)
+		return avx2 ? avx2Classify : sse2Classify;
+#else
+		return NULL;
+#endif
+	}
+
+	// converts 'len' (1 to 8) decimal digits at 'digits' at once; 8 bytes
+	// are read and those after the digits are shifted out
+	inline uint32 swarDigits(const char* digits, const int& len)
+	{
+		assert(len > 0 && len <= 8);
+		uint64 val;
+		std::memcpy(&val, digits, sizeof(val));
+		val <<= (8 - len) << 3;
+		val = ((val & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+		val = ((val & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+		return uint32(((val & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+	}
+
+}
+
+#endif
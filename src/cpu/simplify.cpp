@@ -52,6 +52,7 @@ void Solver::createOT(const bool& reset)
 			}
 		}
 	}
+	ot.compact();
 	if (opts.profile_simp) timer.pstop(), timer.cot += timer.pcpuTime();
 }
 
@@ -86,8 +87,8 @@ void Solver::sortOT()
 		CHECKVAR(v);
 		const uint32 p = V2L(v), n = NEG(p);
 		OL& poss = ot[p], &negs = ot[n];
-		if (poss.size() > 1) Sort(poss, CNF_CMP_KEY());
-		if (negs.size() > 1) Sort(negs, CNF_CMP_KEY());
+		if (poss.size() > 1) Sort(poss.data(), poss.size(), CNF_CMP_KEY());
+		if (negs.size() > 1) Sort(negs.data(), negs.size(), CNF_CMP_KEY());
 	}
 	if (opts.profile_simp) timer.pstop(), timer.sot += timer.pcpuTime();
 }
@@ -101,9 +102,14 @@ void Solver::extract(BCNF& cnf)
 		if (cm.deleted(ref)) continue;
 		const CLAUSE& c = cm[ref];
 		const int size = c.size();
-		const size_t bytes = hc_scsize + (size - 1) * hc_isize;
-		S_REF s = (S_REF) new Byte[bytes];
+		S_REF s = sarena.alloc(size);
 		s->init(c);
+		if (opts.lrat_en) s->set_lratid(c.lratid());
+		if (c.learnt()) {
+			const LMETA& m = meta(c);
+			s->set_lbd(MIN(unsigned(m.lbd()), unsigned(MAX_LBD_M)));
+			s->set_usage(m.usage());
+		}
 		assert(s->size() == size);
 		s->calcSig();
 		rSort(s->data(), size);
@@ -134,19 +140,22 @@ void Solver::awaken()
 	PFLOGN2(2, " Allocating memory..");
 	const size_t numCls = size_t(maxClauses()), numLits = size_t(maxLiterals());
 	const size_t ot_cap = inf.nDualVars * sizeof(OL) + numLits * sizeof(S_REF);
-	const size_t scnf_cap = numCls * sizeof(S_REF) + numLits * sizeof(uint32);
+	const size_t scnf_cap = numCls * (sizeof(S_REF) + hc_scsize) + numLits * sizeof(uint32);
 	if (!checkMem("ot", ot_cap) || !checkMem("scnf", scnf_cap)) {
 		simpstate = AWAKEN_FAIL; 
 		return;
 	}
 	ot.resize(inf.nDualVars), scnf.resize(numCls);
+	sarena.init(numCls, numLits);
 	PFLENDING(2, 5, "(%.1f MB used)", double(ot_cap + scnf_cap) / MBYTE);
 	PFLOGN2(2, " Extracting clauses to simplifying CNF..");
 	printStats(1, '-', CGREEN0);
 	inf.nClauses = inf.nLiterals = 0;
+	bt.clear(true);
 	wt.clear(true);
 	extract(orgs), orgs.clear(true);
 	extract(learnts), learnts.clear(true);
+	lmeta.clear(true);
 	scnf.resize(inf.nClauses);
 	cm.destroy();
 	PFLENDING(2, 5, "(%d clauses extracted)", inf.nClauses);
@@ -226,6 +235,12 @@ void Solver::sigmifying()
 	}
 	if (canMap()) map(true); 
 	else newBeginning();
+	if (*opts.simplified_path && stats.sigma.calls == 1) writeSnapshot(opts.simplified_path, true);
+	if (cache.pending() && stats.sigma.calls == 1) {
+		const string temporary = cache.temporary();
+		writeSnapshot(temporary.c_str(), true);
+		cache.commit(temporary);
+	}
 	rebuildWT(opts.sigma_priorbins);
 	if (retrail()) PFLOG2(2, " Propagation after sigmify proved a contradiction");
 	UPDATE_SLEEPER(sigma, success);
@@ -241,23 +256,25 @@ void Solver::shrinkSimp()
 	S_REF* j = scnf;
 	forall_vector(S_REF, scnf, i) {
 		S_REF c = *i;
-		if (c->deleted()) deleteClause(c);
-		else *j++ = c;
+		if (!c->deleted()) *j++ = c;
 	}
 	scnf.resize(uint32(j - scnf));
+	sarena.compact(scnf);
 	if (opts.profile_simp) timer.stop(), timer.gc += timer.cpuTime();
 }
 
 void Solver::newBeginning() 
 {
 	assert(opts.sigma_en || opts.sigma_live_en);
+	assert(bt.empty());
 	assert(wt.empty());
 	assert(orgs.empty());
 	assert(learnts.empty());
+	assert(lmeta.empty());
 	assert(inf.nClauses == scnf.size());
 	const int64 litsCap = (inf.nLiterals - (inf.nClauses << 1)) * sizeof(uint32);
 	assert(litsCap >= 0);
-	const C_REF bytes = inf.nClauses * sizeof(CLAUSE) + size_t(litsCap);
+	const C_REF bytes = inf.nClauses * (sizeof(CLAUSE) + cm.lead()) + size_t(litsCap);
 	cm.init(bytes);
 	stats.literals.original = stats.literals.learnt = 0;
 	if (opts.aggr_cnf_sort) std::stable_sort(scnf.data(), scnf.data() + scnf.size(), CNF_CMP_KEY());
@@ -266,4 +283,5 @@ void Solver::newBeginning()
 	stats.clauses.learnt = learnts.size();
 	assert(maxClauses() == int64(scnf.size()));
 	scnf.clear(true);
+	sarena.destroy();
 }
\ No newline at end of file
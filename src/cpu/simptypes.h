@@ -21,15 +21,50 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "datatypes.h"
 #include "vector.h"
+#include "slab.h"
 #include "sclause.h"
+#include "sarena.h"
 
 namespace ParaFROST {
 
-	typedef Vec<S_REF, int> OL;
-	typedef Vec<OL> OT;
+	typedef SLIST<S_REF, int> OL;
+	typedef SLISTS<S_REF, int> OT;
 	typedef Vec<S_REF, size_t> SCNF;
 
 
+	// elected variables planned at once by one bve thread
+	constexpr uint32 VE_CHUNK_VARS = 64;
+
+	enum VE_KIND { VE_KEEP = 0, VE_PURE, VE_INVERTER, VE_ANDOR, VE_ITE, VE_XOR, VE_RESOLVE };
+
+	struct VEPLAN {
+		uint32	index, def, resolvents;
+		int		pOrgs, nOrgs;
+		VE_KIND	kind;
+		VEPLAN() : index(0), def(0), resolvents(0), pOrgs(0), nOrgs(0), kind(VE_KEEP) {}
+	};
+
+	/*****************************************************/
+	/*  Usage:   bve plans of consecutive elected        */
+	/*           variables with their resolvents kept    */
+	/*           as sizes followed by literals and two   */
+	/*           parents each, applied in order later    */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	struct VECHUNK {
+		Vec<VEPLAN>	plans;
+		Vec<S_REF>	parents;
+		uVec1D		lits;
+		inline void	push	(const Lits_t& resolvent, const S_REF& ci, const S_REF& cj) {
+			lits.push(resolvent.size());
+			for (int k = 0; k < resolvent.size(); k++) lits.push(resolvent[k]);
+			parents.push(ci), parents.push(cj);
+		}
+		inline void	clear	(const bool& free = false) {
+			plans.clear(free), parents.clear(free), lits.clear(free);
+		}
+	};
+
 	#define forall_occurs(LIST, PTR) \
 		for (S_REF* PTR = LIST, *END = LIST.end(); PTR != END; PTR++)
 }
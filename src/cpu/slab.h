@@ -0,0 +1,278 @@
+/***********************************************************************[slab.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SLAB_
+#define __SLAB_
+
+#include "vector.h"
+
+namespace ParaFROST {
+
+	constexpr int		SLABCLASSES		= 32;
+	constexpr size_t	SLABMINCHUNK	= (1ULL << 12);
+	constexpr size_t	SLABMAXCHUNK	= (1ULL << 24);
+
+	inline int slabClass(size_t n) {
+		int c = 0;
+		while ((size_t(1) << c) < n) c++;
+		return c;
+	}
+
+	/*****************************************************/
+	/*  Usage:   pool of power-of-two blocks carved from */
+	/*           large chunks that never move            */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	template<class T>
+	class SLAB {
+		Vec<T*>	chunks;
+		T		*freed[SLABCLASSES];
+		T		*top, *limit;
+		size_t	nextchunk;
+		int		minclass;
+
+		// blocks on a free list store the next block in their first bytes
+		inline	T*		next		(T* block) const { T* n; std::memcpy(&n, (void*)block, sizeof(T*)); return n; }
+		inline	void	link		(T* block, T* n) { std::memcpy((void*)block, &n, sizeof(T*)); }
+		inline	void	push		(T* block, const int& c) {
+			assert(c >= minclass && c < SLABCLASSES);
+			link(block, freed[c]);
+			freed[c] = block;
+		}
+		inline	void	recycleTail	() {
+			// hand the unused tail of the current chunk to the free lists
+			while (top != limit) {
+				size_t rest = limit - top;
+				int c = 0;
+				while ((size_t(2) << c) <= rest) c++;
+				if (c < minclass) break;
+				push(top, c);
+				top += size_t(1) << c;
+			}
+			top = limit = NULL;
+		}
+		inline	void	newChunk	(const size_t& n) {
+			recycleTail();
+			const size_t elements = n > nextchunk ? n : nextchunk;
+			T* chunk = pfmalloc<T>(elements);
+			chunks.push(chunk);
+			top = chunk, limit = chunk + elements;
+			if (nextchunk < SLABMAXCHUNK) nextchunk <<= 1;
+		}
+	public:
+				SLAB		() : top(NULL), limit(NULL), nextchunk(SLABMINCHUNK), minclass(slabClass((sizeof(T*) + sizeof(T) - 1) / sizeof(T))) {
+			std::memset(freed, 0, sizeof(freed));
+		}
+				~SLAB		() { destroy(); }
+		// returns a block of at least 'n' elements, its capacity in 'cap'
+		template<class S>
+		inline	T*		alloc		(const S& n, S& cap) {
+			assert(n > 0);
+			int c = slabClass(size_t(n));
+			if (c < minclass) c = minclass;
+			assert(c < SLABCLASSES);
+			const size_t bsize = size_t(1) << c;
+			assert(bsize <= size_t(std::numeric_limits<S>::max()));
+			cap = S(bsize);
+			T* block = freed[c];
+			if (block) { freed[c] = next(block); return block; }
+			if (size_t(limit - top) < bsize) newChunk(bsize);
+			block = top;
+			top += bsize;
+			return block;
+		}
+		// blocks smaller than a pointer cannot be linked and are dropped
+		// until the pool is reset; other blocks join the largest class they fit
+		inline	void	release		(T* block, const size_t& cap) {
+			assert(block != NULL);
+			int c = 0;
+			while ((size_t(2) << c) <= cap) c++;
+			if (c < minclass) return;
+			push(block, c);
+		}
+		// takes ownership of a fully used 'chunk' as the only memory of the pool
+		inline	void	adopt		(T* chunk) {
+			destroy();
+			if (chunk != NULL) chunks.push(chunk);
+		}
+		inline	void	destroy		() {
+			for (uint32 i = 0; i < chunks.size(); i++) std::free(chunks[i]);
+			chunks.clear(true);
+			std::memset(freed, 0, sizeof(freed));
+			top = limit = NULL;
+			nextchunk = SLABMINCHUNK;
+		}
+	};
+
+	/*****************************************************/
+	/*  Usage:   vector-like list living in a SLAB pool  */
+	/*           (or on the heap if no pool is attached) */
+	/*  Dependency:  SLAB                                */
+	/*****************************************************/
+	template<class T, class S = int>
+	class SLIST {
+		T*			_mem;
+		S			sz, cap;
+		SLAB<T>*	pool;
+
+		inline	void	release		() {
+			if (_mem == NULL) return;
+			if (pool) pool->release(_mem, size_t(cap));
+			else std::free(_mem);
+			_mem = NULL, cap = 0;
+		}
+		inline	void	move		(const S& min_cap) {
+			assert(sz <= min_cap);
+			if (pool) {
+				S newcap = 0;
+				T* block = pool->alloc(min_cap, newcap);
+				if (sz) std::memcpy((void*)block, (void*)_mem, sz * sizeof(T));
+				release();
+				_mem = block, cap = newcap;
+			}
+			else {
+				pfralloc(_mem, sizeof(T) * min_cap);
+				cap = min_cap;
+			}
+		}
+	public:
+		__forceinline			SLIST		() : _mem(NULL), sz(0), cap(0), pool(NULL) { }
+		__forceinline			~SLIST		() { clear(true); }
+		__forceinline SLIST&	operator=	(SLIST& rhs) { return *this; }
+		__forceinline const T&	operator[]	(const S& index) const { assert(index < sz); return _mem[index]; }
+		__forceinline T&		operator[]	(const S& index) { assert(index < sz); return _mem[index]; }
+		__forceinline const T&	back		() const { assert(sz); return _mem[sz - 1]; }
+		__forceinline T&		back		() { assert(sz); return _mem[sz - 1]; }
+		__forceinline			operator T* () { return _mem; }
+		__forceinline			operator const T* () const { return _mem; }
+		__forceinline T*		data		() { return _mem; }
+		__forceinline const T*	data		() const { return _mem; }
+		__forceinline T*		end			() { return _mem + sz; }
+		__forceinline const T*	end			() const { return _mem + sz; }
+		__forceinline bool		empty		() const { return !sz; }
+		__forceinline S			size		() const { return sz; }
+		__forceinline S			capacity	() const { return cap; }
+		__forceinline void		attach		(SLAB<T>* p) { assert(_mem == NULL); pool = p; }
+		__forceinline void		place		(T* mem, const S& n) { _mem = mem, sz = cap = n; }
+		__forceinline void		forget		() { _mem = NULL, sz = 0, cap = 0; }
+		__forceinline void		pop			() { assert(sz > 0); _mem[--sz].~T(); }
+		__forceinline void		insert		(const T& val) { assert(cap > sz); _mem[sz++] = val; }
+		__forceinline void		push		(const T& val) { if (sz == cap) reserve(sz + 1); new (_mem + sz) T(val); sz++; }
+		__forceinline void		reserve		(const S& min_cap) { if (cap < min_cap) move(min_cap); }
+		__forceinline void		resize		(const S& n) {
+			if (n == sz) return;
+			if (n < sz) shrink(sz - n);
+			else expand(n);
+		}
+		__forceinline void		shrink		(const S& n) {
+			assert(n <= sz);
+			for (S i = 0; i < n; i++) _mem[--sz].~T();
+		}
+		__forceinline void		expand		(const S& size) {
+			if (sz >= size) return;
+			reserve(size);
+			for (S i = sz; i < size; i++) new (&_mem[i]) T();
+			sz = size;
+		}
+		__forceinline void		shrinkCap	() {
+			if (!sz) { clear(true); return; }
+			if (cap > sz) {
+				if (pool) {
+					// only move if a smaller block exists
+					if ((size_t(1) << slabClass(size_t(sz))) < size_t(cap)) move(sz);
+				}
+				else {
+					pfshrinkAlloc(_mem, sizeof(T) * sz);
+					cap = sz;
+				}
+			}
+		}
+		__forceinline void		copyFrom	(SLIST<T, S>& copy) {
+			sz = 0;
+			reserve(copy.size());
+			sz = copy.size();
+			if (sz) std::memcpy((void*)_mem, (void*)copy.data(), sz * sizeof(T));
+		}
+		__forceinline void		clear		(const bool& _free = false) {
+			if (_mem != NULL) {
+				for (S i = 0; i < sz; i++) _mem[i].~T();
+				sz = 0;
+				if (_free) release();
+			}
+		}
+	};
+
+	/*****************************************************/
+	/*  Usage:   table of lists sharing one SLAB pool    */
+	/*  Dependency:  SLAB, SLIST                         */
+	/*****************************************************/
+	template<class T, class S = int>
+	class SLISTS {
+		typedef SLIST<T, S> LIST;
+		Vec<LIST>	lists;
+		SLAB<T>		pool;
+
+		inline	void	forgetAll	() { forall_vector(LIST, lists, l) { l->forget(); } }
+	public:
+		__forceinline				~SLISTS		() { clear(true); }
+		__forceinline const LIST&	operator[]	(const uint32& index) const { return lists[index]; }
+		__forceinline LIST&			operator[]	(const uint32& index) { return lists[index]; }
+		__forceinline LIST*			data		() { return lists.data(); }
+		__forceinline LIST*			end			() { return lists.end(); }
+		__forceinline bool			empty		() const { return lists.empty(); }
+		__forceinline uint32		size		() const { return lists.size(); }
+		__forceinline void			resize		(const uint32& n) {
+			const uint32 old = lists.size();
+			lists.resize(n);
+			for (uint32 i = old; i < n; i++) lists[i].attach(&pool);
+		}
+		__forceinline void			expand		(const uint32& n) {
+			if (lists.size() < n) resize(n);
+		}
+		// lay out all lists back to back in index order
+		// with exact capacities and drop the old pool
+		inline void					compact		() {
+			size_t total = 0;
+			forall_vector(LIST, lists, l) { total += size_t(l->size()); }
+			T* chunk = total ? pfmalloc<T>(total) : NULL;
+			T* mem = chunk;
+			forall_vector(LIST, lists, l) {
+				const S n = l->size();
+				if (n) {
+					std::memcpy((void*)mem, (void*)l->data(), n * sizeof(T));
+					l->place(mem, n);
+					mem += n;
+				}
+				else l->forget();
+			}
+			pool.adopt(chunk);
+		}
+		__forceinline void			shrinkCap	() {
+			compact();
+			lists.shrinkCap();
+		}
+		__forceinline void			clear		(const bool& _free = false) {
+			forgetAll();
+			lists.clear(_free);
+			pool.destroy();
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,236 @@
+/***********************************************************************[snapshot.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solver.h"
+
+using namespace ParaFROST;
+
+#if defined(__GNUC__) && (__GNUC__ >= 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+#endif
+
+// bytes of a clause image before its literals
+#define SNAP_CLAUSE_HEADER (hc_csize - 2 * hc_isize)
+
+inline void writeWords(FILE* file, uint64& hash, const uint32* words, const size_t& n)
+{
+	if (!n) return;
+	snapHash(hash, words, n);
+	fwrite(words, sizeof(uint32), n, file);
+}
+
+void Solver::writeSnapshot(arg_t path, const bool& simplified)
+{
+	assert(path != NULL);
+	PFLOGN2(1, " Writing %s formula to \"%s%s%s\"..", simplified ? "simplified" : "binary", CREPORTVAL, path, CNORMAL);
+	FILE* file = fopen(path, "wb");
+	if (file == NULL) PFLOGE("cannot open binary formula file \"%s\"", path);
+	SNAPHEADER header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, SNAPMAGIC, sizeof(SNAPMAGIC));
+	header.version = SNAPVERSION;
+	header.clausebytes = uint32(hc_csize);
+	header.vars = inf.maxVar;
+	header.headerclauses = MAX(inf.nOrgCls, orgs.size());
+	header.units = trail.size();
+	header.clauses = orgs.size();
+	header.literals = stats.literals.original;
+	if (simplified) {
+		header.flags |= SNAP_SIMPLIFIED;
+		header.orgvars = model.maxVar;
+		header.resolved = model.resolved.size();
+	}
+	uint64 hash = SNAPSEED;
+	// checksum is patched in after the payload
+	fwrite(&header, sizeof(header), 1, file);
+	writeWords(file, hash, trail.data(), header.units);
+	if (simplified) {
+		assert(vorg.size() == inf.maxVar + 1);
+		assert(model.lits.size() == model.maxVar + 1);
+		writeWords(file, hash, vorg.data(), header.vars + 1);
+		writeWords(file, hash, model.lits.data(), header.orgvars + 1);
+		// only eliminated variables are kept, fixed ones are units
+		const size_t statebytes = snapStateBytes(header.vars);
+		Vec<uint32> states(uint32(statebytes / sizeof(uint32)), 0);
+		Byte* state = (Byte*)states.data();
+		forall_variables(v) {
+			const Byte vs = sp->vstate[v].state;
+			state[v] = (MELTED(vs) || SUBSTITUTED(vs)) ? vs : 0;
+		}
+		writeWords(file, hash, states.data(), states.size());
+		writeWords(file, hash, model.resolved.data(), model.resolved.size());
+	}
+	// clause images are written from a zeroed header so that
+	// flags, ids and padding never depend on the solver state
+	Byte image[sizeof(CLAUSE)];
+	forall_cnf(orgs, i) {
+		CLAUSE& c = cm[*i];
+		assert(c.original() && !c.deleted());
+		std::memset(image, 0, sizeof(image));
+		new (image) CLAUSE(c.size());
+		writeWords(file, hash, (uint32*)image, SNAP_CLAUSE_HEADER / hc_isize);
+		writeWords(file, hash, c.data(), c.size());
+		header.bytes += c.capacity();
+	}
+	header.checksum = hash;
+	fseek(file, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, file);
+	if (ferror(file)) PFLOGE("cannot write binary formula file \"%s\"", path);
+	fclose(file);
+	PFLENDING(1, 5, "(%d units, %d clauses, %lld MB)", header.units, header.clauses, ratio(header.bytes, uint64(MBYTE)));
+}
+
+bool Solver::parseSnapshot(const char* path, const uint64& fsz)
+{
+	if (opts.parseincr_en) PFLOGE("binary formulas cannot be parsed incrementally");
+	if (opts.lrat_en) PFLOGE("LRAT proofs cannot be generated from binary formulas");
+	if (fsz < sizeof(SNAPHEADER)) PFLOGE("binary formula is truncated");
+#if defined(__linux__) || defined(__CYGWIN__)
+	int fd = open(path, O_RDONLY, 0);
+	if (fd == -1) PFLOGE("cannot open input file");
+	void* buffer = mmap(NULL, fsz, PROT_READ, MAP_PRIVATE, fd, 0);
+	const Byte* data = (Byte*)buffer;
+#else
+	ifstream inputFile;
+	inputFile.open(path, ifstream::in | ifstream::binary);
+	if (!inputFile.is_open()) PFLOGE("cannot open input file");
+	Byte* buffer = pfmalloc<Byte>(fsz);
+	inputFile.read((char*)buffer, fsz);
+	const Byte* data = buffer;
+#endif
+	SNAPHEADER header;
+	std::memcpy(&header, data, sizeof(header));
+	if (header.version != SNAPVERSION)
+		PFLOGE("binary formula version %d is not supported (expected %d)", header.version, SNAPVERSION);
+	if (header.clausebytes != hc_csize)
+		PFLOGE("binary formula was written with a different clause layout");
+	const bool simplified = header.flags & SNAP_SIMPLIFIED;
+	uint64 words = header.units;
+	if (simplified) words += uint64(header.vars) + header.orgvars + 2 + snapStateBytes(header.vars) / hc_isize + header.resolved;
+	if (fsz != sizeof(header) + words * hc_isize + header.bytes || (header.bytes & 3))
+		PFLOGE("binary formula is truncated or corrupted");
+	const uint32* units = (const uint32*)(data + sizeof(header));
+	const uint32* sections = units + header.units;
+	const Byte* images = (const Byte*)(units + words);
+	uint64 hash = SNAPSEED;
+	snapHash(hash, units, words);
+	snapHash(hash, (const uint32*)images, header.bytes / hc_isize);
+	if (hash != header.checksum) PFLOGE("checksum mismatch in binary formula");
+	if (simplified && opts.proof_en)
+		PFLOGE("a proof of the original formula cannot be generated from a simplified one");
+	RESETSTRUCT(&inf);
+	inf.orgVars = simplified ? header.orgvars : header.vars;
+	inf.nOrgCls = header.headerclauses;
+	if (header.vars == 0 || header.vars >= INT_MAX - 1 || inf.orgVars < header.vars)
+		PFLOGE("number of variables in binary formula not supported");
+	if (header.clauses > inf.nOrgCls) PFLOGE("too many clauses");
+	PFLOG2(1, " Found %s formula (version %d) with %s%d variables, %d units, and %d clauses%s",
+		simplified ? "simplified" : "binary", header.version, CREPORTVAL, header.vars, header.units, header.clauses, CNORMAL);
+	// allocate for the current variables and restore
+	// the mapping to the original ones afterwards
+	const uint32 orgVars = inf.orgVars;
+	inf.orgVars = header.vars;
+	initFormula();
+	inf.orgVars = orgVars;
+	if (simplified) loadSimplified(header, sections);
+	bool sat = true;
+	for (uint32 i = 0; sat && i < header.units; i++) {
+		const uint32 unit = units[i];
+		if (unit < 2 || unit >= inf.nDualVars) PFLOGE("binary formula has an invalid unit");
+		const LIT_ST val = sp->value[unit];
+		if (UNASSIGNED(val)) {
+			if (opts.proof_en) proof.addUnit(unit);
+			enqueueUnit(unit), formula.units++;
+		}
+		else if (!val) sat = false;
+	}
+	if (sat && header.bytes) {
+		// one copy into the clause arena, then rebuild 'orgs' and watches in a linear scan
+		orgs.reserve(header.clauses);
+		const C_REF start = cm.bulk(images, header.bytes), end = start + header.bytes;
+		C_REF r = start;
+		while (r < end) {
+			if (end - r < hc_csize) PFLOGE("binary formula has a truncated clause");
+			// 'bulk' checks only where the image starts
+			if (r >= MAX_WREF) PFLOGE("binary formula exceeds the watch addressable limit (%zd) at byte %zd", C_REF(MAX_WREF), r - start);
+			CLAUSE& c = cm[r];
+			const int size = c.size();
+			if (size < 2 || c.learnt() || c.deleted() || r + c.capacity() > end)
+				PFLOGE("binary formula has an invalid clause at byte %zd", r - start);
+			forall_clause(c, k) {
+				if (*k < 2 || *k >= inf.nDualVars) PFLOGE("binary formula has an invalid literal");
+			}
+			if (size == 2) formula.binaries++;
+			else if (size == 3) formula.ternaries++;
+			else formula.large++;
+			if (size > formula.maxClauseSize) formula.maxClauseSize = size;
+			if (opts.proof_en) proof.addClause(c);
+			newClause(r, c, false);
+			attachWatch(r, c);
+			r += c.capacity();
+		}
+		if (orgs.size() != header.clauses || stats.literals.original != header.literals)
+			PFLOGE("binary formula does not match its header");
+	}
+#if defined(__linux__) || defined(__CYGWIN__)
+	if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean input file %s mapping", path);
+	close(fd);
+#else
+	std::free(buffer);
+	inputFile.close();
+#endif
+	return sat;
+}
+
+void Solver::loadSimplified(const SNAPHEADER& header, const uint32* sections)
+{
+	assert(header.flags & SNAP_SIMPLIFIED);
+	assert(inf.maxVar == header.vars);
+	const uint32 orgvars = header.orgvars;
+	const uint32* orgmap = sections;
+	const uint32* lits = orgmap + header.vars + 1;
+	const Byte* state = (const Byte*)(lits + orgvars + 1);
+	const uint32* resolved = (const uint32*)(state + snapStateBytes(header.vars));
+	assert(vorg.size() == inf.maxVar + 1);
+	forall_variables(v) {
+		if (!orgmap[v] || orgmap[v] > orgvars) PFLOGE("simplified formula has an invalid variable mapping");
+		vorg[v] = orgmap[v];
+	}
+	model.maxVar = orgvars;
+	model.lits.resize(orgvars + 1);
+	for (uint32 v = 0; v <= orgvars; v++) {
+		if (lits[v] >= inf.nDualVars) PFLOGE("simplified formula has an invalid model mapping");
+		model.lits[v] = lits[v];
+	}
+	model.resolved.resize(uint32(header.resolved));
+	for (uint64 i = 0; i < header.resolved; i++) model.resolved[uint32(i)] = resolved[i];
+	forall_variables(v) {
+		const Byte vs = state[v];
+		if (MELTED(vs)) markEliminated(v), inf.maxMelted++;
+		else if (SUBSTITUTED(vs)) markSubstituted(v);
+		else if (vs) PFLOGE("simplified formula has an invalid variable state");
+	}
+	formula.simplified = true;
+	PFLOG2(1, "  restored %s%d original variables%s, %s%d eliminated%s, and %s%lld witness words%s",
+		CREPORTVAL, orgvars, CNORMAL, CREPORTVAL, inf.maxMelted + inf.maxSubstituted, CNORMAL, CREPORTVAL, header.resolved, CNORMAL);
+}
+
+#if defined(__GNUC__) && (__GNUC__ >= 8)
+#pragma GCC diagnostic pop
+#endif
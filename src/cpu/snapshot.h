@@ -0,0 +1,82 @@
+/***********************************************************************[snapshot.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SNAPSHOT_
+#define __SNAPSHOT_
+
+#include "datatypes.h"
+#include <cstdio>
+#include <cstring>
+
+namespace ParaFROST {
+
+	// binary formula layout:
+	//   SNAPHEADER
+	//   'units' unit literals (uint32 each)
+	//   if SNAP_SIMPLIFIED is set (formula written after sigmify):
+	//     'vars' + 1 words of 'vorg' (current to original variables)
+	//     'orgvars' + 1 words of 'model.lits' (original variables to current literals)
+	//     'vars' + 1 variable states (one byte each, padded to 4 bytes)
+	//     'resolved' words of the model reconstruction stack
+	//   'bytes' of clause images as laid out in 'CMM'
+	//   (a CLAUSE header without its first two literals,
+	//    followed by all literals of the clause)
+	// the checksum covers everything after the header
+	constexpr char		SNAPMAGIC[8]	= { 'P', 'F', 'C', 'N', 'F', 'B', 'I', 'N' };
+	constexpr uint32	SNAPVERSION		= 4;
+	constexpr uint32	SNAP_SIMPLIFIED	= 0x01;
+	constexpr uint64	SNAPSEED		= 0xCBF29CE484222325ULL;
+	constexpr uint64	SNAPPRIME		= 0x100000001B3ULL;
+
+	struct SNAPHEADER {
+		char	magic[8];
+		uint32	version, clausebytes;
+		uint32	vars, headerclauses;
+		uint32	units, clauses;
+		uint32	flags, orgvars;
+		uint64	resolved;
+		uint64	literals, bytes;
+		uint64	checksum;
+	};
+
+	// FNV-1a over 32-bit words (all sections are multiples of 4 bytes)
+	inline void snapHash(uint64& hash, const uint32* words, const size_t& n)
+	{
+		uint64 h = hash;
+		for (size_t i = 0; i < n; i++) {
+			h ^= words[i];
+			h *= SNAPPRIME;
+		}
+		hash = h;
+	}
+
+	inline size_t snapStateBytes(const uint32& vars) { return (size_t(vars) + 4) & ~size_t(3); }
+
+	inline bool isSnapshot(const char* path)
+	{
+		FILE* file = fopen(path, "rb");
+		if (file == NULL) return false;
+		char magic[sizeof(SNAPMAGIC)];
+		const size_t n = fread(magic, 1, sizeof(magic), file);
+		fclose(file);
+		return n == sizeof(magic) && !std::memcmp(magic, SNAPMAGIC, sizeof(magic));
+	}
+
+}
+
+#endif
@@ -35,10 +35,12 @@ Solver::Solver(const string& _path) :
 	, conflict(NOREF)
 	, ignore(NOREF)
 	, cnfstate(UNSOLVED_M)
+	, tokens()
 	, intr(false)
 	, stable(false)
 	, probed(false)
 	, incremental(false)
+	, simdsearch(false)
 	, mapped(false)
 	, simpstate(AWAKEN_SUCC)
 {
@@ -57,10 +59,11 @@ void Solver::allocSolver()
 	assert(inf.maxVar);
 	assert(sp == NULL);
 	const uint32 maxSize = inf.maxVar + 1;
-	const C_REF initcap = inf.nOrgCls * sizeof(CLAUSE) + maxSize;
+	const C_REF initcap = C_REF(headerClauses()) * sizeof(CLAUSE) + maxSize;
 	sp = new SP(maxSize);
 	sp->initSaved(opts.polarity);
 	cm.init(initcap);
+	bt.resize(inf.nDualVars);
 	wt.resize(inf.nDualVars);
 	trail.reserve(inf.maxVar);
 	dlevels.reserve(inf.maxVar);
@@ -80,6 +83,9 @@ void Solver::initSolver()
 	assert(UNSOLVED(cnfstate));
 	forceFPU();
 	opts.init();
+	simdsearch = opts.simdsearch_en && hasAVX2();
+	if (simdsearch) PFLOG2(1, " Using AVX2 to search for new watches in long clauses");
+	if (opts.simdparse_en) tokens.classify = pickClassifier(hasAVX2());
 	subbin.resize(2);
 	dlevels.push(0);
 	if (opts.proof_en) {
@@ -89,7 +95,15 @@ void Solver::initSolver()
 			opts.proof_nonbinary_en = true;
 		}
 #endif
-		proof.handFile(opts.proof_path, opts.proof_nonbinary_en);
+		if (opts.lrat_en) {
+			if (opts.parseincr_en) PFLOGE("LRAT proofs cannot be generated with incremental parsing");
+			cm.storeIds(true), sarena.storeIds(true);
+			if (opts.decompose_en) {
+				PFLOG2(1, "  Disabling SCC decomposition as it cannot emit LRAT hints");
+				opts.decompose_en = false;
+			}
+		}
+		proof.handFile(opts.proof_path, opts.proof_nonbinary_en, opts.lrat_en, size_t(opts.proof_buffer) << 10, opts.proof_queue, opts.proof_level);
 	}
 }
 
@@ -175,12 +189,16 @@ void Solver::wrapup()
 		assert(sp != NULL && sp->value != NULL);
 		if (opts.model_en) {
 			model.extend(sp->value);
-			if (opts.modelprint_en) 
+			if (*opts.model_path)
+				model.print(opts.model_path);
+			else if (opts.modelprint_en)
 				model.print();
 		}
 		if (opts.modelverify_en) {
 			model.extend(sp->value);
-			model.verify(formula.path);
+			if (!model.orgcnf.empty()) model.verify(opts.verify_threads);
+			else if (formula.compressed || formula.snapshot) PFLOGW("verifying a model against a compressed or binary formula is not supported");
+			else model.verify(formula.path);
 		}
 	}
 	else if (cnfstate == UNSAT) PFLOGS("UNSATISFIABLE");
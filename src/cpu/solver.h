@@ -35,6 +35,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "solvertypes.h"
 #include "simptypes.h"
 #include "dimacs.h"
+#include "snapshot.h"
+#include "cache.h"
 
 namespace ParaFROST {
 	/*****************************************************/
@@ -49,12 +51,14 @@ namespace ParaFROST {
 		TIMER			timer;
 		CMM				cm;
 		WT				wt;
+		BT				bt;
 		SP				*sp;
 		LIMIT			limit;
 		LAST			last;
 		STATS			stats;
 		SLEEP			sleep;
 		BCNF			orgs, learnts, reduced;
+		LMETAS			lmeta;
 		VMAP			vmap;
 		Lits_t			learntC;
 		CLAUSE			subbin;
@@ -64,27 +68,31 @@ namespace ParaFROST {
 		Vec<uint64>		bumps;
 		Vec<double>		activity;
 		Vec<CSIZE>		scheduled;
+		Vec<LKEY>		reducible;
 		Vec<OCCUR>		occurs;
 		Vec<DWATCH>		dwatches;
-		Vec<WOL>		wot;
-		Vec<BOL>		bot;	
+		WOT				wot;
+		BOT				bot;
 		Vec1D			lbdlevels;
 		uVec1D			eligible;
 		uVec1D			probes;
 		uVec1D			dlevels;
 		uVec1D			trail;
 		uVec1D			vorg, vhist;
-		uVec1D			analyzed, minimized;
+		uVec1D			analyzed, minimized, hintstack;
 		LBDREST			lbdrest;
 		LUBYREST		lubyrest;
 		RANDOM			random;
 		WALK			tracker;
+		CACHE			cache;
+		DEDUP			dedup;
 		uint64			bumped;
 		C_REF			conflict, ignore;
 		size_t			solLineLen;
 		string			solLine;
 		CNF_ST			cnfstate;
-		bool			intr, stable, probed, incremental;
+		TOKENIZER		tokens;
+		bool			intr, stable, probed, incremental, simdsearch;
 	public:
 		OPTION			opts;
 		MODEL			model;
@@ -100,10 +108,14 @@ namespace ParaFROST {
 		inline LIT_ST	sortClause			(CLAUSE&, const int&, const int&, const bool&);
 		inline void		moveClause			(C_REF&, CMM&);
 		inline void		moveWatches			(WL&, CMM&);
-		inline uint32	minReachable		(WL&, DFS*, const DFS&);
-		inline bool		depFreeze			(const uint32& cand, const LIT_ST* values, LIT_ST* frozen, uint32*& stack, WL& ws);
+		inline void		moveWatches			(BL&, CMM&);
+		inline uint32*	searchWatch			(CLAUSE&, const LIT_ST*, uint32&);
+		inline void		forwardWatches		(WL&);
+		inline void		forwardWatches		(BL&);
+		inline uint32	minReachable		(BL&, DFS*, const DFS&);
+		inline bool		depFreeze			(const uint32& cand, const LIT_ST* values, LIT_ST* frozen, uint32*& stack, BL& bs, WL& ws);
 		inline void		MDMAssume			(const LIT_ST* values, LIT_ST* frozen, uint32*& tail, bool& skip);
-		inline bool		valid				(const LIT_ST* values, WL& ws);
+		inline bool		valid				(const LIT_ST* values, BL& bs, WL& ws);
 		inline void		recycleWL			(const uint32&);
 		inline bool		findBinary			(uint32, uint32);
 		inline bool		findTernary			(uint32, uint32, uint32);
@@ -113,7 +125,7 @@ namespace ParaFROST {
 		inline bool		isBinary			(const C_REF&, uint32&, uint32&);
 		inline uint32	propAutarkClause	(const bool&, const C_REF&, CLAUSE&, const LIT_ST*, LIT_ST*);
 		inline bool		proplarge			(const uint32&, const bool&);
-		inline bool		propbinary			(const uint32&);
+		inline bool		propbinary			(const uint32&, uint64&);
 		inline void		cancelAssign		(const uint32&);
 		inline void		cancelAutark		(const bool&, const uint32&, LIT_ST*);
 		inline void		pumpFrozenHeap		(const uint32&);
@@ -147,7 +159,12 @@ namespace ParaFROST {
 		inline bool		useTarget			() const { return (stable && opts.targetphase_en) || opts.targetonly_en; }
 		inline bool		vsidsOnly			() const { return (stable && opts.vsidsonly_en); }
 		inline bool		vsidsEnabled		() const { return (stable && opts.vsids_en); }
-		inline bool		canPreSigmify		() const { return opts.sigma_en && stats.clauses.original; }
+		inline bool		canPreSigmify		() const { return opts.sigma_en && !formula.simplified && stats.clauses.original; }
+		// header clauses worth reserving for: a clause takes at least 6 bytes of a plain
+		// file and a stream has no known size, so a bogus header cannot blow up memory
+		inline uint32	headerClauses		() const {
+			return formula.size ? uint32(MIN(uint64(inf.nOrgCls), formula.size / 6 + 1)) : MIN(inf.nOrgCls, DEDUP_MIN_CAP);
+		}
 		inline bool		canRephase			() const { return opts.rephase_en && stats.conflicts > limit.rephase; }
 		inline bool		canReduce			() const { return opts.reduce_en && stats.clauses.learnt && stats.conflicts >= limit.reduce; }
 		inline bool		canCollect			() const { return cm.garbage() > (cm.size() * opts.gc_perc); }
@@ -249,7 +266,14 @@ namespace ParaFROST {
 			}
 		}
 		inline void		learnEmpty			() {
-			if (opts.proof_en) proof.addEmpty();
+			if (opts.proof_en) {
+				if (opts.lrat_en && proof.noHints() && REASON(conflict)) {
+					CLAUSE& c = cm[conflict];
+					forall_clause(c, k) { proof.hintUnit(*k); }
+					proof.hint(c.lratid());
+				}
+				proof.addEmpty();
+			}
 			cnfstate = UNSAT;
 		}
 		inline void		clearLevels			() {
@@ -288,7 +312,7 @@ namespace ParaFROST {
 		}
 		inline void		clearMDM			() {
 			assert(verifyMDM());
-			LIT_ST* seen = sp->seen;
+			SEENS seen = sp->seen;
 			for (uint32* i = trail + sp->propagated, *end = trail.end(); i != end; ++i)
 				seen[ABS(*i)] = 0;
 
@@ -310,7 +334,8 @@ namespace ParaFROST {
 		}
 		inline void		attachDelayed		() {
 			forall_dwatches(dwatches, d) {
-				wt[FLIP(d->lit)].push(WATCH(d->ref, d->size, d->imp));
+				if (d->size == 2) bt[FLIP(d->lit)].push(BWATCH(d->ref, cm[d->ref].learnt(), d->imp));
+				else wt[FLIP(d->lit)].push(WATCH(d->ref, d->size, d->imp));
 			}
 			dwatches.clear();
 		}
@@ -341,6 +366,18 @@ namespace ParaFROST {
 		inline uint64	cacheLines			(const size_t& len, const size_t& unit) {
 			return (len * unit) >> 6; // 64-byte cache line is assumed
 		}
+		inline LMETA&	meta				(const CLAUSE& c) {
+			assert(c.learnt());
+			assert(c.id() < lmeta.size());
+			return lmeta[c.id()];
+		}
+		inline LMETA&	attachMeta			(const C_REF& ref, CLAUSE& c) {
+			assert(c.learnt());
+			const uint32 id = lmeta.size();
+			c.set_id(id);
+			lmeta.push(LMETA(ref));
+			return lmeta[id];
+		}
 		inline void		attachClause		(const C_REF& ref, const CLAUSE& c) {
 			assert(ref < NOREF);
 			const int size = c.size();
@@ -362,15 +399,22 @@ namespace ParaFROST {
 			CHECKLIT(c[1]);
 			const int size = c.size();
 			assert(size > 1);
-			wt[FLIP(c[0])].push(WATCH(ref, size, c[1]));
-			wt[FLIP(c[1])].push(WATCH(ref, size, c[0]));
+			if (size == 2) {
+				const bool learnt = c.learnt();
+				bt[FLIP(c[0])].push(BWATCH(ref, learnt, c[1]));
+				bt[FLIP(c[1])].push(BWATCH(ref, learnt, c[0]));
+			}
+			else {
+				wt[FLIP(c[0])].push(WATCH(ref, size, c[1]));
+				wt[FLIP(c[1])].push(WATCH(ref, size, c[0]));
+			}
 		}
 		inline void		attachWatch			(const uint32& lit, const uint32& imp, const C_REF& ref, const int& size) {
 			CHECKLIT(lit);
 			CHECKLIT(imp);
 			assert(lit != imp);
 			assert(ref < NOREF);
-			assert(size > 1);
+			assert(size > 2);
 			wt[FLIP(lit)].push(WATCH(ref, size, imp));
 		}
 		inline void		delayWatch			(const uint32& lit, const uint32& imp, const C_REF& ref, const int& size) {
@@ -389,7 +433,7 @@ namespace ParaFROST {
 			WATCH *j = ws;
 			forall_watches(ws, i) {
 				const WATCH w = *i;
-				if (NEQUAL(w.ref, ref))
+				if (NEQUAL(w.ref(), ref))
 					*j++ = w;
 			}
 			assert(j + 1 == ws.end());
@@ -413,19 +457,21 @@ namespace ParaFROST {
 			trail.push(lit);
 			assert(inf.unassigned);
 			inf.unassigned--;
-			if (!level) learnUnit(lit, v);
+			if (!level) learnUnit(lit, v, src);
 #ifdef LOGGING
 			PFLNEWLIT(this, 4, src, lit);
 #endif
 			assert(wt.size());
+			assert(bt.size());
+			BL& bs = bt[lit];
 			WL& ws = wt[lit];
-			if (ws.size()) {
 #if defined(_WIN32)
-				PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &ws[0]);
+			if (bs.size()) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &bs[0]);
+			if (ws.size()) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &ws[0]);
 #else
-				__builtin_prefetch(&ws[0], 0, 1);
+			if (bs.size()) __builtin_prefetch(&bs[0], 0, 1);
+			if (ws.size()) __builtin_prefetch(&ws[0], 0, 1);
 #endif
-			}
 		}
 		inline void		enqueueUnit			(const uint32& lit) {
 			CHECKLIT(lit);
@@ -443,14 +489,16 @@ namespace ParaFROST {
 			PFLNEWLIT(this, 3, NOREF, lit);
 #endif
 			if (wt.size()) {
+				assert(bt.size());
+				BL& bs = bt[lit];
 				WL& ws = wt[lit];
-				if (ws.size()) {
 #if defined(_WIN32)
-					PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &ws[0]);
+				if (bs.size()) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &bs[0]);
+				if (ws.size()) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &ws[0]);
 #else
-					__builtin_prefetch(&ws[0], 0, 1);
+				if (bs.size()) __builtin_prefetch(&bs[0], 0, 1);
+				if (ws.size()) __builtin_prefetch(&ws[0], 0, 1);
 #endif
-				}
 			}
 		}
 		inline void		enqueueImp			(const uint32& lit, const C_REF& src) {
@@ -472,8 +520,17 @@ namespace ParaFROST {
 			}
 			return fl;
 		}
-		inline void		learnUnit			(const uint32& lit, const uint32& v) {
-			if (opts.proof_en) proof.addUnit(lit);
+		inline void		learnUnit			(const uint32& lit, const uint32& v, const C_REF& src = NOREF) {
+			if (opts.proof_en) {
+				if (opts.lrat_en && REASON(src)) {
+					CLAUSE& c = cm[src];
+					forall_clause(c, k) {
+						if (NEQUAL(*k, lit)) proof.hintUnit(*k);
+					}
+					proof.hint(c.lratid());
+				}
+				proof.addUnit(lit);
+			}
 			assert(ABS(lit) == v);
 			markFrozen(v);
 		}
@@ -569,10 +626,22 @@ namespace ParaFROST {
 		void	newClause			(SCLAUSE&);
 		C_REF	newClause			(const Lits_t&, const bool&);
 		void	newClause			(const C_REF&, CLAUSE&, const bool&);
-		bool	toClause			(Lits_t&, Lits_t&, int&);
-		bool	toClause			(Lits_t&, Lits_t&, char*&);
+		bool	toClause			(Lits_t&, Lits_t&);
+		bool	toClause			(Lits_t&, Lits_t&, char*&, const char*);
+		bool	isDuplicate			(const Lits_t&, const uint64&);
+		bool	parseChunks			(Lits_t&, Lits_t&, char*, char*, const int&);
+		bool	parseStream			(Lits_t&, Lits_t&, DSOURCE&);
+		void	parseHeader			(char*&);
+		void	initFormula			();
+		bool	parseSnapshot		(const char*, const uint64&);
+		uint64	cacheKey			(const uint64&);
+		bool	lookupCache			(const bool&);
+		void	writeSnapshot		(arg_t, const bool&);
+		void	loadSimplified		(const SNAPHEADER&, const uint32*);
 		void	backtrack			(const int& jmplevel = 0);
 		void	recycle				(CMM&);
+		void	compact				();
+		void	compactMeta			();
 		void	filter				(BCNF&, CMM&);
 		void	filter				(BCNF&);
 		void	shrink				(BCNF&);
@@ -584,7 +653,6 @@ namespace ParaFROST {
 		void	histCNF				(BCNF& cnf, const bool& reset = false);
 		void	attachBins			(BCNF&, const bool& hasElim = false);
 		void	attachNonBins		(BCNF&, const bool& hasElim = false);
-		void	attachClauses		(BCNF&, const bool& hasElim = false);
 		bool	substitute			(BCNF&, uint32*);
 		void	attachTernary		(BCNF&, LIT_ST*);
 		void	scheduleTernary		(LIT_ST*);
@@ -597,6 +665,8 @@ namespace ParaFROST {
 		void	ternaryResolve		(const uint32&, const uint64&);
 		void	subsumeLearnt		(const C_REF&);
 		void	analyzeFailed		(const uint32&);
+		void	learnFailed			(const uint32&);
+		void	hintChain			(const C_REF&, const uint32*, const int&, const uint32& skip = 0);
 		uint32	makeAssign			(const uint32&, const bool& tphase = false);
 		bool	minimize			(const uint32&, const int& depth = 0);
 		void	rebuildWT			(const CL_ST& priorbins = 0);
@@ -615,7 +685,6 @@ namespace ParaFROST {
 		void	transitive			();
 		bool	canVivify			();
 		void	vivify				();
-		void	sortWT				();
 		void	pumpFrozen			();
 		void	allocSolver			();
 		void	initLimits			();
@@ -668,6 +737,8 @@ namespace ParaFROST {
 		void	map					(BCNF&);
 		void	map					(WL&);
 		void	map					(WT&);
+		void	map					(BL&);
+		void	map					(BT&);
 		void	map					(const bool& sigmified = false);
 				Solver			(const string&);
 		//==========================================//
@@ -676,6 +747,7 @@ namespace ParaFROST {
 	protected:
 		uVec1D	PVs;
 		SCNF	scnf;
+		SARENA	sarena;
 		OT		ot;
 		uint32	mu_inc;
 		bool	mapped;
@@ -786,9 +858,11 @@ namespace ParaFROST {
 			return (phase == opts.phases) || (lr <= opts.lits_min && phase > 2);
 		}
 		inline void		bumpShrunken		(SCLAUSE&);
-		inline void		newResolvent		(const Lits_t&);
-		inline void		xresolve			(const uint32&, Lits_t& out_c);
-		inline void		xsubstitute			(const uint32&, Lits_t& out_c);
+		inline void		newResolvent		(const Lits_t&, const SCLAUSE&, const SCLAUSE&);
+		inline void		xresolve			(const uint32&, Lits_t& out_c, VECHUNK&);
+		inline void		xsubstitute			(const uint32&, Lits_t& out_c, VECHUNK&);
+		inline void		planVE				(const uint32&, VECHUNK&, Lits_t& out_c);
+		inline void		applyVE				(VECHUNK&, Lits_t& out_c);
 		inline bool		propClause			(const LIT_ST*, const uint32&, SCLAUSE&);
 		inline void		depFreeze			(OL&, const uint32&, const uint32&, const uint32&);
 		inline bool		checkMem			(const string&, const size_t&);
@@ -815,7 +889,6 @@ namespace ParaFROST {
 		void			strengthen			(SCLAUSE&, const uint32&);
 		void			removeClause		(SCLAUSE&);
 		void			removeClause		(S_REF);
-		void			deleteClause		(S_REF&);
 		//==========================================//
 		//             Local search                 //
 		//==========================================//
@@ -840,9 +913,13 @@ namespace ParaFROST {
 		//==========================================//
 	protected:
 		Vec<LIT_ST>		ifrozen, ivalue, iphase, imarks;
+#if defined(HOTSP)
+		Vec<HOTVAR>		ihot;
+#else
 		Vec<VSTATE>		ivstate;
 		Vec<C_REF>		isource;
 		Vec1D			ilevel;
+#endif
 		Lits_t			assumptions, iconflict;
 	public:
 						Solver			();
@@ -881,6 +958,7 @@ namespace ParaFROST {
 		void printOccurs		(const uint32& v);
 		void printWL			(const uint32&, const bool& bin = 0);
 		void printWL			(const WL&, const bool& bin = 0);
+		void printBL			(const BL&);
 		void printWatched		(const uint32& v);
 		void printBinaries		(const uint32& v);
 		void printSortedStack	(const int&);
@@ -30,10 +30,12 @@ Solver::Solver() :
 	, conflict(NOREF)
 	, ignore(NOREF)
 	, cnfstate(UNSOLVED_M)
+	, tokens()
 	, intr(false)
 	, stable(false)
 	, probed(false)
 	, incremental(true)
+	, simdsearch(false)
 	, mapped(false)
 	, simpstate(AWAKEN_SUCC)
 {
@@ -52,8 +54,12 @@ void Solver::iallocSpace()
 	assert(vorg.size() == inf.maxVar + 1);
 	assert(V2L(inf.maxVar + 1) == inf.nDualVars);
 	assert(model.lits.size() == inf.maxVar + 1);
+#if defined(HOTSP)
+	assert(ihot.size() == inf.maxVar + 1);
+#else
 	assert(ilevel.size() == ivstate.size());
 	assert(ilevel.size() == inf.maxVar + 1);
+#endif
 	assert(imarks.empty());
 	vorg[0] = 0;
 	model.lits[0] = 0;
@@ -65,11 +71,15 @@ void Solver::iallocSpace()
 	sp = newSP;
 	if (opts.proof_en)
 		proof.init(sp, vorg);
-	ilevel.clear(true);
 	ivalue.clear(true);
 	iphase.clear(true);
+#if defined(HOTSP)
+	ihot.clear(true);
+#else
+	ilevel.clear(true);
 	isource.clear(true);
 	ivstate.clear(true);
+#endif
 	PFLDONE(2, 5);
 	PFLMEMCALL(this, 2);
 }
@@ -21,14 +21,20 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "space.h"
 #include "watch.h"
+#include "slab.h"
 
 namespace ParaFROST {
 	
 	typedef Vec<C_REF> BCNF;
-	typedef Vec<WATCH, int> WL;
-	typedef Vec<WL> WT;
-	typedef Vec<uint32, int> BOL;
-	typedef Vec<C_REF, int> WOL;
+	typedef Vec<LMETA, uint32> LMETAS;
+	typedef SLIST<WATCH, int> WL;
+	typedef SLISTS<WATCH, int> WT;
+	typedef SLIST<BWATCH, int> BL;
+	typedef SLISTS<BWATCH, int> BT;
+	typedef SLIST<uint32, int> BOL;
+	typedef SLISTS<uint32, int> BOT;
+	typedef SLIST<C_REF, int> WOL;
+	typedef SLISTS<C_REF, int> WOT;
 	
 	struct CSIZE {
 		C_REF ref;
@@ -37,6 +43,13 @@ namespace ParaFROST {
 		CSIZE(const C_REF& _r, const uint32& _s) : ref(_r), size(_s) {}
 	};
 
+	struct LKEY {
+		C_REF ref;
+		uint32 lbd, size;
+		LKEY() {}
+		LKEY(const C_REF& _r, const uint32& _l, const uint32& _s) : ref(_r), lbd(_l), size(_s) {}
+	};
+
 	struct DFS {
 		uint32 idx, min;
 		DFS() : idx(0), min(0) { }
@@ -24,6 +24,49 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "vstate.h"
 
 namespace ParaFROST {
+
+#if defined(HOTSP)
+	/*****************************************************/
+	/*  Usage:    per-variable fields read together in   */
+	/*            conflict analysis (array of structs)   */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+	struct HOTVAR {
+		C_REF	source;
+		int		level;
+		VSTATE	vstate;
+		LIT_ST	seen;
+		HOTVAR() : source(NOREF), level(UNDEFINED), seen(0) {}
+	};
+	// indexes one field of consecutive 'HOTVAR' records like an array
+	template <class T>
+	class HOTFIELD {
+		Byte* _mem;
+	public:
+		HOTFIELD() = default;
+		HOTFIELD(T* field) : _mem((Byte*)field) {}
+		template <class U>
+		HOTFIELD(const HOTFIELD<U>& other) : _mem(other.data()) {}
+		inline Byte*	data		() const { return _mem; }
+		inline T&		operator [] (const size_t& i) const { return *(T*)(_mem + i * sizeof(HOTVAR)); }
+	};
+	typedef HOTFIELD<int>			LEVELS;
+	typedef HOTFIELD<const int>		CLEVELS;
+	typedef HOTFIELD<C_REF>			SOURCES;
+	typedef HOTFIELD<const C_REF>	CSOURCES;
+	typedef HOTFIELD<VSTATE>		VSTATES;
+	typedef HOTFIELD<const VSTATE>	CVSTATES;
+	typedef HOTFIELD<LIT_ST>		SEENS;
+#else
+	typedef int*			LEVELS;
+	typedef const int*		CLEVELS;
+	typedef C_REF*			SOURCES;
+	typedef const C_REF*	CSOURCES;
+	typedef VSTATE*			VSTATES;
+	typedef const VSTATE*	CVSTATES;
+	typedef LIT_ST*			SEENS;
+#endif
+
 	/*****************************************************/
 	/*  Usage:    Information of search space            */
 	/*  Dependency: none                                 */
@@ -42,12 +85,13 @@ namespace ParaFROST {
 						PUTCH('\n'); PFLOGN0("\t\t"); }
 	public:
 		// arrays
-		int* level;
+		LEVELS level;
 		uint32* tmpstack, *stacktail;
 		uint64* board;
-		C_REF* source;
-		VSTATE* vstate;
-		LIT_ST* seen, * frozen, * marks;
+		SOURCES source;
+		VSTATES vstate;
+		SEENS seen;
+		LIT_ST* frozen, * marks;
 		LIT_ST* value, * psaved, * ptarget, * pbest;
 		// scalers
 		int learntLBD;
@@ -63,6 +107,36 @@ namespace ParaFROST {
 			RESETSTRUCT(this);
 			assert(sizeof(C_REF) == sizeof(uint64));
 			assert(sizeof(VSTATE) == sizeof(Byte));
+#if defined(HOTSP)
+			const size_t hotBytes = calcBytes<HOTVAR>(size, 1);
+			const size_t vec8Bytes = calcBytes<uint64>(size, 1);
+			const size_t vec4Bytes = calcBytes<uint32>(size, 1);
+			const size_t vec1Bytes = calcBytes<LIT_ST>(size, 7);
+			_sz = size;
+			_cap = hotBytes + vec1Bytes + vec4Bytes + vec8Bytes;
+			assert(_cap);
+			pfralloc(_mem, _cap);
+			assert(_mem != NULL);
+			memset(_mem, 0, _cap);
+			// records
+			HOTVAR* hot = (HOTVAR*)_mem;
+			source = &hot->source;
+			level = &hot->level;
+			vstate = &hot->vstate;
+			seen = &hot->seen;
+			// 8-byte arrays
+			board = (uint64*)(_mem + hotBytes);
+			// 4-byte arrays
+			tmpstack = (uint32*)(_mem + hotBytes + vec8Bytes);
+			// 1-byte arrays
+			value = (LIT_ST*)(_mem + hotBytes + vec8Bytes + vec4Bytes);
+			frozen = value + _sz + _sz;
+			psaved = frozen + _sz;
+			ptarget = psaved + _sz;
+			pbest = ptarget + _sz;
+			marks = pbest + _sz;
+			assert(_mem + _cap == addr_t(marks) + _sz);
+#else
 			const size_t vec8Bytes = calcBytes<C_REF>(size, 2);
 			const size_t vec4Bytes = calcBytes<uint32>(size, 2);
 			const size_t vec1Bytes = calcBytes<LIT_ST>(size, 9);
@@ -88,6 +162,7 @@ namespace ParaFROST {
 			marks = pbest + _sz;
 			vstate = (VSTATE*)(marks + _sz);
 			assert(_mem + _cap == addr_t(vstate) + _sz);
+#endif
 			// initialize with custom values
 			memset(value, UNDEFINED, _sz + _sz);
 			memset(marks, UNDEFINED, _sz);
@@ -69,14 +69,25 @@ void Solver::report()
 		PFLOG1(" %sSystem memory          : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(sysMemUsed()), double(MBYTE)), CNORMAL);
 		PFLOG1(" %sFormula                : %s%-s%s", CREPORT, CREPORTVAL, formula.path.c_str(), CNORMAL);
 		PFLOG1(" %s Size                  : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(formula.size), double(MBYTE)), CNORMAL);
+		if (formula.compressed)
+			PFLOG1(" %s Compressed size       : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(formula.compressed), double(MBYTE)), CNORMAL);
 		PFLOG1(" %s Units                 : %s%-10d%s", CREPORT, CREPORTVAL, formula.units, CNORMAL);
 		PFLOG1(" %s Binaries              : %s%-10d%s", CREPORT, CREPORTVAL, formula.binaries, CNORMAL);
 		PFLOG1(" %s Ternaries             : %s%-10d%s", CREPORT, CREPORTVAL, formula.ternaries, CNORMAL);
 		PFLOG1(" %s Larger                : %s%-10d%s", CREPORT, CREPORTVAL, formula.large, CNORMAL);
+		if (formula.duplicates)
+			PFLOG1(" %s Duplicates            : %s%-10d%s", CREPORT, CREPORTVAL, formula.duplicates, CNORMAL);
 		PFLOG1(" %s Max clause size       : %s%-10d%s", CREPORT, CREPORTVAL, formula.maxClauseSize, CNORMAL);
 		PFLOG1(" %s C2V ratio             : %s%-10.3f%s", CREPORT, CREPORTVAL, formula.c2v, CNORMAL);
-		if (opts.proof_en)
+		if (opts.proof_en) {
 			PFLOG1(" %s Proof lines           : %s%-16zd%s", CREPORT, CREPORTVAL, proof.numClauses(), CNORMAL);
+			PFLOG1(" %s Proof size            : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(proof.numBytes()), double(MBYTE)), CNORMAL);
+			PFLOG1(" %s Proof writer stalls   : %s%-16lld%s", CREPORT, CREPORTVAL, proof.numStalls(), CNORMAL);
+			if (opts.lrat_en) {
+				PFLOG1(" %s LRAT hints            : %s%-16lld%s", CREPORT, CREPORTVAL, proof.numHints(), CNORMAL);
+				PFLOG1(" %s Hint chains time      : %s%-16.3f  ms%s", CREPORT, CREPORTVAL, timer.lrat, CNORMAL);
+			}
+		}
 		PFLOG1(" %sAutarky calls          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.autarky.calls, CNORMAL);
 		PFLOG1(" %s Removed variables     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.autarky.eliminated, CNORMAL);
 		PFLOG1(" %sBacktracks             : %s%-16lld%s", CREPORT, CREPORTVAL, stats.backtrack.chrono + stats.backtrack.nonchrono, CNORMAL);
@@ -84,6 +95,7 @@ void Solver::report()
 		PFLOG1(" %s Non-Chronological     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.backtrack.nonchrono, CNORMAL);
 		PFLOG1(" %s Trail reuses          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.reuses, CNORMAL);
 		PFLOG1(" %sConflicts              : %s%-16lld%s", CREPORT, CREPORTVAL, stats.conflicts, CNORMAL);
+		PFLOG1(" %s Per second            : %s%-16.2f%s", CREPORT, CREPORTVAL, ratio(double(stats.conflicts), double(timer.solve)), CNORMAL);
 		PFLOG1(" %s OTF strengthened      : %s%-16lld%s", CREPORT, CREPORTVAL, stats.subsume.strengthenedfly, CNORMAL);
 		PFLOG1(" %s OTF subsumed          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.subsume.subsumedfly, CNORMAL);
 		PFLOG1(" %s Learnt OTF subsumes   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.subtried, CNORMAL);
@@ -108,6 +120,7 @@ void Solver::report()
 		PFLOG1(" %s Added ternaries       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.ternary.ternaries, CNORMAL);
 		PFLOG1(" %s Subsumed ternaries    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.ternary.binaries * 2, CNORMAL);
 		PFLOG1(" %sReduces                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.reduces, CNORMAL);
+		PFLOG1(" %s Time                  : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.reduce, CNORMAL);
 #ifdef STATISTICS
 		PFLOG1(" %s Removed binaries      : %s%-16lld%s", CREPORT, CREPORTVAL, stats.binary.reduced, CNORMAL);
 		PFLOG1(" %s Removed ternaries     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.ternary.reduced, CNORMAL);
@@ -150,6 +163,7 @@ void Solver::report()
 		PFLOG1(" %sSearch decisions       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decisions.single, CNORMAL);
 		PFLOG1(" %s Propagations          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.searchprops, CNORMAL);
 		PFLOG1(" %s Ticks                 : %s%-16lld%s", CREPORT, CREPORTVAL, stats.searchticks, CNORMAL);
+		PFLOG1(" %s Prefetched clauses    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.prefetched, CNORMAL);
 		PFLOG1(" %sMappings               : %s%-10d%s", CREPORT, CREPORTVAL, stats.mappings, CNORMAL);
 		PFLOG1(" %sMDM calls              : %s%-10d%s", CREPORT, CREPORTVAL, stats.mdm.calls, CNORMAL);
 		PFLOG1(" %s Walks                 : %s%-10d%s", CREPORT, CREPORTVAL, stats.mdm.walks, CNORMAL);
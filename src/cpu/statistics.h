@@ -78,6 +78,7 @@ namespace ParaFROST {
 		} vivify;
 		SIGMASTATS sigma;
 		uint64 searchprops, searchticks, probeticks, transitiveticks;
+		uint64 prefetched;
 		uint64 marker;
 		uint64 conflicts;
 		uint64 stablemodes;
@@ -39,13 +39,14 @@ inline void Solver::strengthen(CLAUSE& c, const uint32& self) {
 	}
 	assert(j + 1 == c.end());
 	shrinkClause(c, 1);
-	c.initTier3();
+	if (c.learnt()) meta(c).initTier3();
 }
 
 inline void	Solver::removeSubsumed(CLAUSE& c, const C_REF& cref, CLAUSE* s) {
 	assert(s->size() <= c.size());
 	assert(c.size() > 2);
 	if (c.original() && s->learnt()) {
+		meta(*s).markDead();
 		s->markOriginal();
 		const int ssize = s->size();
 		stats.clauses.original++;
@@ -137,6 +138,7 @@ inline CL_ST Solver::subsumeClause(CLAUSE& c, const C_REF& cref)
 	if (self) {
 		PFLCLAUSE(3, c, "  candidate ");
 		PFLCLAUSE(3, (*s), "  strengthened by ");
+		if (opts.lrat_en) proof.hint(s->lratid()), proof.hint(c.lratid());
 		strengthen(c, FLIP(self));
 		return -1;
 	}
@@ -184,6 +186,7 @@ bool Solver::subsumeAll()
 	assert(inf.unassigned);
 	assert(conflict == NOREF);
 	assert(cnfstate != UNSAT);
+	assert(bt.empty());
 	assert(wt.empty());
 	SET_BOUNDS(sub_limit, subsume, subsume.checks, searchprops, 0);
 	// schedule clauses
@@ -222,7 +225,8 @@ bool Solver::subsumeAll()
 			if (st > 0) { subsumed++; continue; }
 			if (st < 0) { shrunken.push(r); strengthened++; }
 		}
-		bool subsume = true, orgbin = (c.binary() && c.original());
+		// original binaries have no clause ids in 'bot'
+		bool subsume = true, orgbin = (!opts.lrat_en && c.binary() && c.original());
 		uint32 minlit = 0, minhist = 0;
 		int minsize = 0;
 		forall_clause(c, k) {
@@ -268,6 +272,7 @@ void Solver::subsume()
 	assert(UNSOLVED(cnfstate));
 	stats.subsume.calls++;
 	printStats(1, '-', CORANGE0);
+	bt.clear(true);
 	wt.clear(true);
 	bool success = subsumeAll();
 	rebuildWT(opts.subsume_priorbins);
@@ -132,6 +132,7 @@ inline bool selfsubsume(const uint32& x, const uint32& fx, OL& list, SCLAUSE& ca
 		if (subsuming.deleted()) continue;
 		if (subsize > 1 && selfsub(subsuming.sig(), candsig) && selfsub(x, fx, subsuming, cand)) {
 			PFLCLAUSE(4, cand, " Clause ");
+			if (solver->opts.lrat_en) solver->proof.hint(subsuming.lratid()), solver->proof.hint(cand.lratid());
 			solver->strengthen(cand, x);
 			cand.melt(); // mark for fast recongnition in ot update 
 			PFLCLAUSE(4, subsuming, " Strengthened by ");
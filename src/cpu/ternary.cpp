@@ -146,7 +146,7 @@ void Solver::ternaryResolve(const uint32& p, const uint64& limit)
             if (neg.binary()) continue;
             stats.ternary.checks++;
             if (hyper3Resolve(*pos, neg, p)) {
-                if (opts.proof_en) proof.addClause(learntC);
+                if (opts.lrat_en) proof.hint(pos->lratid()), proof.hint(neg.lratid());
                 const int size = learntC.size();
                 bool learnt = false;
                 if (size == 3) {
@@ -156,13 +156,15 @@ void Solver::ternaryResolve(const uint32& p, const uint64& limit)
                 else {
                     assert(size == 2);
                     learnt = pos->learnt() && neg.learnt();
-                    PFLOG2(4, "  hyper ternary resolvent subsumes resolved clauses");
-                    removeClause(*pos, pref);
-                    removeClause(neg, nref);
                     stats.ternary.binaries++;
                 }
-                newHyper3(learnt);
+                newHyper3(learnt); // the resolvent is added to the proof before its antecedents are deleted
                 pos = cm.clause(pref); // update if cm memory is reallocated
+                if (size == 2) {
+                    PFLOG2(4, "  hyper ternary resolvent subsumes resolved clauses");
+                    removeClause(*pos, pref);
+                    removeClause(cm[nref], nref);
+                }
             }
             learntC.clear();
             assert(cm.clause(pref) == pos);
@@ -174,7 +176,7 @@ void Solver::ternaryResolve(const uint32& p, const uint64& limit)
 void Solver::scheduleTernary(LIT_ST* use)
 {
     assert(vschedule.empty());
-    VSTATE* states = sp->vstate;
+    VSTATES states = sp->vstate;
     forall_variables(v) {
         if (states[v].state) continue;
         const uint32 p = V2L(v), n = NEG(p);
@@ -232,6 +234,7 @@ void Solver::ternary()
     assert(sp->propagated == trail.size());
     SLEEPING(sleep.ternary, opts.ternary_sleep_en);
     stats.ternary.calls++;
+    bt.clear(true);
     wt.clear(true);
     wot.resize(inf.nDualVars);
     LIT_ST* use = pfcalloc<LIT_ST>(inf.nDualVars);
@@ -25,21 +25,21 @@ void Solver::transiting(const uint32& src, const uint64& limit, uint64& removed,
 	bool failed = false;
 	assert(unassigned(src));
 	PFLOG2(4, "  performing transitive reduction on literal %d", l2i(src));
-	WL& sws = wt[src];
-	stats.transitiveticks += cacheLines(sws.size(), sizeof(WATCH)) + 1;
+	BL& sbs = bt[src];
+	stats.transitiveticks += cacheLines(sbs.size(), sizeof(BWATCH)) + 1;
 	uVec1D& marked = minimized;
-	forall_watches(sws, i) {
+	forall_bwatches(sbs, i) {
 		assert(!failed);
-		const WATCH sw = *i;
-		if (!sw.binary()) break;
-		const C_REF cref = sw.ref;
+		const BWATCH sw = *i;
+		const C_REF cref = sw.ref();
 		if (cm.deleted(cref)) continue;
 		const uint32 dest = sw.imp;
 		CHECKLIT(dest);
 		if (!unassigned(dest)) continue;
 		CLAUSE& c = cm[cref];
 		PFLCLAUSE(4, c, "  finding a transitive path to %d using", l2i(dest));
-		const bool learnt = c.learnt();
+		const bool learnt = sw.learnt();
+		assert(learnt == c.learnt());
 		assert(marked.empty());
 		assert(UNASSIGNED(l2marker(src)));
 		markLit(src);
@@ -51,17 +51,15 @@ void Solver::transiting(const uint32& src, const uint64& limit, uint64& removed,
 			CHECKLIT(assign);
 			assert(l2marker(assign) == SIGN(assign));
 			PFLOG2(4, "  transitively propagating %d in:", l2i(assign));
-			WL& aws = wt[assign];
-			stats.transitiveticks += cacheLines(aws.size(), sizeof(WATCH)) + 1;
-			forall_watches(aws, j) {
-				const WATCH aw = *j;
-				if (!aw.binary()) break;
-				const C_REF dref = aw.ref;
+			BL& abws = bt[assign];
+			stats.transitiveticks += cacheLines(abws.size(), sizeof(BWATCH)) + 1;
+			forall_bwatches(abws, j) {
+				const BWATCH aw = *j;
+				const C_REF dref = aw.ref();
 				if (dref == cref) continue;
+				if (!learnt && aw.learnt()) continue;
 				if (cm.deleted(dref)) continue;
-				const CLAUSE& d = cm[dref];
-				if (!learnt && d.learnt()) continue;
-				PFLCLAUSE(4, d, "  ");
+				PFLCLAUSE(4, cm[dref], "  ");
 				const uint32 other = aw.imp;
 				CHECKLIT(other);
 				if (other == dest) { 
@@ -96,8 +94,9 @@ void Solver::transiting(const uint32& src, const uint64& limit, uint64& removed,
 	if (failed) {
 		units++;
 		PFLOG2(4, "  found failed literal %d during transitive reduction", l2i(src));
-		enqueueUnit(FLIP(src));
-		if (BCP()) {
+		if (opts.lrat_en) learnFailed(src);
+		else enqueueUnit(FLIP(src));
+		if (cnfstate && BCP()) {
 			PFLOG2(2, " Propagation within transitive reduction proved a contradiction");
 			learnEmpty();
 		}
@@ -111,7 +110,6 @@ void Solver::transitive()
 	assert(probed);
 	assert(!DL());
 	assert(sp->propagated == trail.size());
-	sortWT();
 	SET_BOUNDS(limit, transitive, transitiveticks, searchticks, 0);
 	assert(last.transitive.literals < inf.nDualVars);
 	uint32 tried = 0, units = 0;
@@ -40,20 +40,21 @@ inline void	Solver::bumpClause(CLAUSE& c)
 {
 	assert(c.learnt());
 	assert(c.size() > 2);
-	const bool hyper = c.hyper();
-	if (!hyper && c.keep()) return;
-	const CL_ST used = c.usage();
-	c.initTier3();
+	LMETA& m = meta(c);
+	const bool hyper = m.hyper();
+	if (!hyper && m.keep()) return;
+	const CL_ST used = m.usage();
+	m.initTier3();
 	if (hyper) return;
-	const int old_lbd = c.lbd();
+	const int old_lbd = m.lbd();
 	const int new_lbd = calcLBD(c);
 	if (new_lbd < old_lbd) { // update old LBD
-		if (new_lbd <= opts.lbd_tier1) c.set_keep(true);
-		else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) c.initTier2();
-		c.set_lbd(new_lbd);
+		if (new_lbd <= opts.lbd_tier1) m.set_keep(true);
+		else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) m.initTier2();
+		m.set_lbd(new_lbd);
 		PFLCLAUSE(4, c, "  bumping clause with lbd %d ", new_lbd);
 	}
-	else if (used && old_lbd <= opts.lbd_tier2) c.initTier2();
+	else if (used && old_lbd <= opts.lbd_tier2) m.initTier2();
 }
 
 inline void	Solver::analyzeLit(const uint32& lit, int& track, int& size)
@@ -136,7 +137,10 @@ inline void Solver::strengthenOTF(CLAUSE& c, const C_REF& ref, const uint32& sel
 	c[0] = other, c[1] = self;
 	assert(c[0] != c[1]);
 	detachWatch(FLIP(self), ref);
-	if (opts.proof_en) proof.shrinkClause(c, self);
+	// LRAT derives the strengthened clause from the current conflict
+	// once its root literals are removed as well
+	if (opts.lrat_en) hintChain(conflict, c, c.size(), self);
+	else if (opts.proof_en) proof.shrinkClause(c, self);
 	uint32* j = c + 1, * end = c.end();
 	for (uint32* i = c + 2; i != end; i++) {
 		const uint32 lit = *i;
@@ -146,6 +150,7 @@ inline void Solver::strengthenOTF(CLAUSE& c, const C_REF& ref, const uint32& sel
 	}
 	const int removed = int(end - j);
 	shrinkClause(c, removed);
+	if (opts.lrat_en) proof.renewClause(c);
 	int maxPos = 1;
 	int maxLevel = l2dl(c[1]);
 	const int size = c.size();
@@ -160,12 +165,17 @@ inline void Solver::strengthenOTF(CLAUSE& c, const C_REF& ref, const uint32& sel
 	if (NEQUAL(maxPos, 1)) swap(c[1], c[maxPos]);
 	const uint32 first = c[0];
 	const uint32 second = c[1];
+	if (size == 2) {
+		detachWatch(FLIP(first), ref);
+		attachWatch(ref, c);
+		return;
+	}
 	attachWatch(second, first, ref, size);
 	WL& ws = wt[FLIP(first)];
 	forall_watches(ws, i) {
-		if (i->ref == ref) {
+		if (i->ref() == ref) {
 			i->imp = second;
-			i->size = size;
+			i->set_size(size);
 			break;
 		}
 	}
@@ -73,9 +73,10 @@ bool Solver::analyzeVivify(CLAUSE& cand, bool& original)
 	assert(DL());
 	CLAUSE& conf = cm[conflict];
 	bool conflictoriginality = conf.original();
-	int* levels = sp->level;
-	C_REF* sources = sp->source;
-	LIT_ST* values = sp->value, *seen = sp->seen;
+	LEVELS levels = sp->level;
+	SOURCES sources = sp->source;
+	LIT_ST* values = sp->value;
+	SEENS seen = sp->seen;
 	assert(conf.size() > 1);
 	PFLCLAUSE(4, conf, "  analyzing conflict");
 	forall_clause(conf, k) {
@@ -172,6 +173,7 @@ bool Solver::learnVivify(CLAUSE& cand, const C_REF& cref, const int& nonFalse, c
 	PFLLEARNT(this, 3);
 	const int learntsize = learntC.size();
 	assert(learntsize <= nonFalse);
+	if (opts.lrat_en && learntsize < nonFalse) hintChain(conflict, learntC, learntsize);
 	bool success;
 	if (learntsize == 1) {
 		PFLOG2(4, "  candidate is strengthened by a unit");
@@ -191,10 +193,11 @@ bool Solver::learnVivify(CLAUSE& cand, const C_REF& cref, const int& nonFalse, c
 	else if (learntsize < nonFalse) {
 		PFLOG2(4, "  candidate is strengthened");
 		backtrack();
-		if (opts.proof_en) proof.addClause(learntC);
-		removeClause(cand, cref);
+		const bool learnt = cand.learnt();
 		sp->learntLBD = learntsize - 1;
-		newClause(learntC, cand.learnt());
+		const C_REF r = newClause(learntC, learnt);
+		if (opts.proof_en) proof.addClause(cm[r]);
+		removeClause(cm[cref], cref);
 #ifdef STATISTICS
 		stats.vivify.strengthened++;
 #endif
@@ -359,13 +362,13 @@ void Solver::schedule2viv(BCNF& schedule, const bool& tier2, const bool& learnt)
 		PFLSHRINKLEARNT(this, 2, beforeCls, beforeLits);
 		for (CL_ST p = 0; p < 2; p++) {
 			const bool priority = p;
-			forall_cnf(learnts, i) {
-				const C_REF ref = *i;
+			forall_vector(LMETA, lmeta, m) {
+				if (m->dead() || m->hyper()) continue;
+				if (m->lbd() < lowlbd) continue;
+				if (m->lbd() > highlbd) continue;
+				const C_REF ref = m->ref();
 				if (cm.deleted(ref)) continue;
 				CLAUSE& c = cm[ref];
-				if (c.hyper()) continue;
-				if (c.lbd() < lowlbd) continue;
-				if (c.lbd() > highlbd) continue;
 				if (c.vivify() != priority) continue;
 				assert(c.learnt());
 				if (priority) prioritized++;
@@ -416,6 +419,7 @@ void Solver::vivifying(const CL_ST& type)
 	const bool tier2 = ISVIVIFYTIER2(type);
 	const bool learnt = tier2 || ISVIVIFYTIER1(type);
 	BCNF schedule;
+	bt.clear(true);
 	wt.clear(true);
 	vhist.resize(inf.nDualVars);
 	memset(vhist, 0, sizeof(uint32) * inf.nDualVars);
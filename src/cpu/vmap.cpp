@@ -38,6 +38,34 @@ void Solver::map(WL& ws)
 	}
 }
 
+void Solver::map(BL& bs)
+{
+	if (bs.empty()) return;
+	forall_bwatches(bs, w) {
+		w->imp = vmap.mapLit(w->imp);
+	}
+}
+
+void Solver::map(BT& bt)
+{
+	if (bt.empty()) return;
+	assert(!vmap.empty());
+	forall_variables(v) {
+		const uint32 mVar = vmap.mapped(v);
+		if (mVar) {
+			const uint32 p = V2L(v), n = NEG(p);
+			const uint32 mpos = V2L(mVar), mneg = NEG(mpos);
+			if (NEQUAL(mVar, v)) { // map binary lists
+				bt[mpos].copyFrom(bt[p]);
+				bt[mneg].copyFrom(bt[n]);
+			}
+			map(bt[mpos]), map(bt[mneg]); // then map binary imps
+		}
+	}
+	bt.resize(V2L(vmap.size()));
+	bt.shrinkCap();
+}
+
 void Solver::map(WT& wt)
 {
 	if (wt.empty()) return;
@@ -92,7 +120,7 @@ void Solver::map(const bool& sigmified)
 	// map transitive start literal
 	vmap.mapTransitive(last.transitive.literals);
 	// map clauses and watch tables
-	if (!sigmified) map(orgs), map(learnts), map(wt);
+	if (!sigmified) map(orgs), map(learnts), map(bt), map(wt);
 	else mapped = true, newBeginning(), mapped = false;
 	// map trail, queue and heap
 	vmap.mapShrinkLits(trail);
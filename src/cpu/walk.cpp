@@ -75,6 +75,7 @@ void Solver::walk()
 	assert(UNSOLVED(cnfstate));
 	assert(sp->propagated == trail.size());
 	stats.walk.calls++;
+	bt.clear(true);
 	wt.clear(true);
 	shrinkTop(true);
 	bot.resize(inf.nDualVars); // used as occurrence table for indexing 'tracker.cinfo'
@@ -333,7 +334,7 @@ void Solver::walking()
 inline void Solver::walkassign()
 {
 	const bool targeting = useTarget();
-	const VSTATE* states = sp->vstate;
+	CVSTATES states = sp->vstate;
 	LIT_ST* values = tracker.value;
 	if (assumptions.empty()) {
 		forall_variables(v) {
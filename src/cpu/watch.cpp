@@ -24,7 +24,7 @@ void Solver::attachBins(BCNF& src, const bool& hasElim)
 {
     assert(!wt.empty());
     if (hasElim) {
-        const VSTATE* states = sp->vstate;
+        CVSTATES states = sp->vstate;
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
@@ -55,7 +55,7 @@ void Solver::attachNonBins(BCNF& src, const bool& hasElim)
 {
     assert(!wt.empty());
     if (hasElim) {
-        const VSTATE* states = sp->vstate;
+        CVSTATES states = sp->vstate;
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
@@ -91,95 +91,29 @@ void Solver::attachNonBins(BCNF& src, const bool& hasElim)
     }
 }
 
-void Solver::attachClauses(BCNF& src, const bool& hasElim)
-{
-    assert(!wt.empty());
-    if (hasElim) {
-        const VSTATE* states = sp->vstate;
-        forall_cnf(src, i) {
-            const C_REF r = *i;
-            if (cm.deleted(r)) continue;
-            assert(r < cm.size());
-            CLAUSE& c = cm[r];
-            bool removed = false;
-            forall_clause(c, k) {
-                const uint32 lit = *k;
-                if (MELTED(states[ABS(lit)].state)) {
-                    removed = true;
-                    break;
-                }
-            }
-            if (removed)
-                removeClause(c, r);
-            else {
-                if (!c.binary()) sortClause(c);
-                attachWatch(r, c);
-            }
-        }
-    }
-    else {
-        forall_cnf(src, i) {
-            const C_REF r = *i;
-            if (cm.deleted(r)) continue;
-            assert(r < cm.size());
-            CLAUSE& c = cm[r];
-            if (!c.binary()) sortClause(c);
-            attachWatch(r, c);
-        }
-    }
-}
-
 void Solver::rebuildWT(const CL_ST& code)
 {
     wt.resize(inf.nDualVars);
-    if (PRIORALLBINS(code)) {
-        if (PRIORLEARNTBINS(code)) {
-            attachBins(learnts);
-            attachBins(orgs);
-        }
-        else {
-            attachBins(orgs);
-            attachBins(learnts);
-        }
-        attachNonBins(orgs);
-        attachNonBins(learnts);
+    bt.resize(inf.nDualVars);
+    if (PRIORLEARNTBINS(code)) {
+        attachBins(learnts);
+        attachBins(orgs);
     }
     else {
-        attachClauses(orgs);
-        attachClauses(learnts);
+        attachBins(orgs);
+        attachBins(learnts);
     }
-}
-
-void Solver::sortWT()
-{
-    WL saved;
-    forall_literal(lit) {
-        assert(saved.empty());
-        WL& ws = wt[lit];
-        WATCH *j = ws;
-        forall_watches(ws, i) {
-            const WATCH w = *i;
-            if (w.binary()) *j++ = w;
-            else saved.push(w);
-        }
-        ws.resize(int(j - ws));
-        forall_watches(saved, i) { ws.push(*i); }
-        saved.clear();
-    }
-    saved.clear(true);
+    attachNonBins(orgs);
+    attachNonBins(learnts);
+    bt.compact();
+    wt.compact();
 }
 
 void Solver::detachClauses(const bool& keepbinaries)
 {
     forall_literal(lit) {
-        WL& ws = wt[lit];
-        WATCH* j = ws;
-        forall_watches(ws, i) {
-            const WATCH w = *i;
-            if (keepbinaries && w.binary()) 
-                *j++ = w;
-        }
-        ws.resize(int(j - ws));
+        wt[lit].clear();
+        if (!keepbinaries) bt[lit].clear();
     }
 }
 
@@ -189,24 +123,24 @@ void Solver::binarizeWT(const bool& keeplearnts)
     const LIT_ST* values = sp->value;
     forall_literal(lit) {
 		const LIT_ST litval = values[lit];
-		WL& ws = wt[FLIP(lit)];
-		WATCH* j = ws;
-		forall_watches(ws, i) {
-			const WATCH w = *i;
-			if (w.binary()) {
-                const C_REF ref = w.ref;
-                if (cm.deleted(ref)) continue;
-				const uint32 imp = w.imp;
-                if (litval > 0 || values[imp] > 0) {
-                    if (lit < imp)
-                        removeClause(cm[ref], ref);
-                }
-                else {
-                    if (cm[ref].original() || keeplearnts)
-                        *j++ = w;                
-                }
-			}
+		const uint32 flit = FLIP(lit);
+		wt[flit].clear();
+		BL& bs = bt[flit];
+		BWATCH* j = bs;
+		forall_bwatches(bs, i) {
+			const BWATCH w = *i;
+            const C_REF ref = w.ref();
+            if (cm.deleted(ref)) continue;
+			const uint32 imp = w.imp;
+            if (litval > 0 || values[imp] > 0) {
+                if (lit < imp)
+                    removeClause(cm[ref], ref);
+            }
+            else {
+                if (!w.learnt() || keeplearnts)
+                    *j++ = w;                
+            }
 		}
-		ws.resize(int(j - ws));
+		bs.resize(int(j - bs));
     }
 }
@@ -25,15 +25,33 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace ParaFROST {
 
+	// 8-byte watch: the clause reference is stored as a 32-bit word
+	// offset into 'CMM' with the binary tag kept in the lowest bit
 	struct WATCH {
-		C_REF	ref;
 		uint32	imp;
-		int		size;
+		uint32	_tagged;
 
-		inline		WATCH	() : ref(NOREF), imp(0), size(0) { }
+		inline		WATCH	() : imp(0), _tagged(0) { }
 		inline		WATCH	(const C_REF& cref, const int& _size, const uint32& _imp) :
-			ref(cref), imp(_imp), size(_size) {}
-		inline bool binary	() const { return size == 2; }
+			imp(_imp), _tagged(W_REF(cref) | (_size == 2)) { assert(cref < MAX_WREF && !(cref & 3)); }
+		inline C_REF ref	() const { return C_REF(_tagged & W_REF_MASK) << 1; }
+		inline bool binary	() const { return _tagged & 1; }
+		inline void set_ref	(const C_REF& cref) { assert(cref < MAX_WREF && !(cref & 3)); _tagged = W_REF(cref) | (_tagged & 1); }
+		inline void set_size(const int& _size) { _tagged = (_tagged & W_REF_MASK) | (_size == 2); }
+	};
+
+	// binary implication: the implied literal plus the clause reference
+	// (kept as a reason) tagged with the learnt flag in the lowest bit
+	struct BWATCH {
+		uint32	imp;
+		uint32	_tagged;
+
+		inline		BWATCH	() : imp(0), _tagged(0) { }
+		inline		BWATCH	(const C_REF& cref, const bool& _learnt, const uint32& _imp) :
+			imp(_imp), _tagged(W_REF(cref) | _learnt) { assert(cref < MAX_WREF && !(cref & 3)); }
+		inline C_REF ref	() const { return C_REF(_tagged & W_REF_MASK) << 1; }
+		inline bool learnt	() const { return _tagged & 1; }
+		inline void set_ref	(const C_REF& cref) { assert(cref < MAX_WREF && !(cref & 3)); _tagged = W_REF(cref) | (_tagged & 1); }
 	};
 
 	struct DWATCH {
@@ -46,13 +64,14 @@ namespace ParaFROST {
 			ref(_ref), lit(_lit), imp(_imp), size(_size) {}
 	};
 
-	#define PRIORALLBINS(CODE) (CODE & 1)
-
 	#define PRIORLEARNTBINS(CODE) (CODE & 2)
 
 	#define forall_watches(WS, PTR) \
 		for (WATCH* PTR = WS, *WSEND = WS.end(); PTR != WSEND; PTR++)
 
+	#define forall_bwatches(BS, PTR) \
+		for (BWATCH* PTR = BS, *BSEND = BS.end(); PTR != BSEND; PTR++)
+
 	#define forall_dwatches(DWS, PTR) \
 		for (DWATCH* PTR = DWS, *DWSEND = DWS.end(); PTR != DWSEND; PTR++)
 }